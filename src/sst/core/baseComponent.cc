@@ -63,6 +63,8 @@ BaseComponent::BaseComponent(ComponentId_t id) :
 
 BaseComponent::~BaseComponent()
 {
+    delete clock_wakeup_;
+
     // Need to cleanup my ComponentInfo and delete all my children.
 
     // If my_info_ is nullptr, then we are being deleted by our
@@ -397,6 +399,47 @@ BaseComponent::reregisterClock(TimeConverter freq, Clock::HandlerBase* handler)
     return sim_->reregisterClock(freq, handler, CLOCKPRIORITY);
 }
 
+void
+BaseComponent::sleepClockUntilEvent(Clock::HandlerBase* handler)
+{
+    if ( !handler->isActive() ) return;
+
+    if ( nullptr == clock_wakeup_ ) {
+        clock_wakeup_ = new ClockWakeup();
+
+        // Attach the wakeup to the handlers for all the links that
+        // have already been configured.  Links configured after this
+        // will get it in configureLink_impl().
+        LinkMap* myLinks = my_info_->getLinkMap();
+        if ( myLinks != nullptr ) {
+            for ( auto& x : myLinks->getLinkMap() ) {
+                if ( x.second == nullptr ) continue;
+                // Polling links will not have a handler
+                Event::HandlerBase* ev_handler = reinterpret_cast<Event::HandlerBase*>(x.second->pair_link->delivery_info);
+                if ( ev_handler ) {
+                    EventHandlerMetaData mdata(my_info_->getID(), getName(), getType(), x.first);
+                    ev_handler->attachTool(clock_wakeup_, mdata);
+                }
+            }
+        }
+    }
+
+    handler->deactivate();
+    clock_wakeup_->sleep(handler);
+}
+
+void
+BaseComponent::ClockWakeup::beforeHandler(uintptr_t UNUSED(key), const Event* UNUSED(ev))
+{
+    if ( sleeping_.empty() ) return;
+
+    // Handlers may have been reactivated by other means while asleep
+    for ( auto* handler : sleeping_ ) {
+        if ( !handler->isActive() ) handler->activate();
+    }
+    sleeping_.clear();
+}
+
 
 Cycle_t
 BaseComponent::getNextClockCycle(TimeConverter freq)
@@ -458,6 +501,11 @@ BaseComponent::serialize_order(SST::Core::Serialization::serializer& ser)
             SST_SER(clock_period);
             SST_SER(handler);
         }
+        // The wakeup is also serialized through the attached tools of
+        // the event handlers, which use a serializable pointer.  Use
+        // the same pointer here so it is only serialized once.
+        SST::Core::Serialization::serializable* wakeup = clock_wakeup_;
+        SST_SER(wakeup);
         break;
     }
     case SST::Core::Serialization::serializer::UNPACK:
@@ -482,6 +530,12 @@ BaseComponent::serialize_order(SST::Core::Serialization::serializer& ser)
 
             sim_->registerClock_restart(clock_period, handler, CLOCKPRIORITY);
         }
+        // Sleeping handlers were restored above as inactive.  The
+        // wakeup itself is restored with the event handlers it is
+        // attached to, so this just reconnects the pointer.
+        SST::Core::Serialization::serializable* wakeup = nullptr;
+        SST_SER(wakeup);
+        clock_wakeup_ = dynamic_cast<ClockWakeup*>(wakeup);
         break;
     }
     case SST::Core::Serialization::serializer::MAP:
@@ -592,6 +646,13 @@ BaseComponent::configureLink_impl(const std::string& name, SimTime_t timebase, E
                 // Add the send profiler to the link
                 if ( tool->profileSends() ) tmp->attachTool(tool, mdata);
             }
+
+            // If any clock handlers have been put to sleep, events on
+            // this link also need to be able to wake them
+            if ( clock_wakeup_ ) {
+                EventHandlerMetaData mdata(my_info_->getID(), getName(), getType(), name);
+                handler->attachTool(clock_wakeup_, mdata);
+            }
         }
 
         // Check for PortModules
@@ -491,6 +491,22 @@ protected:
     */
     Cycle_t reregisterClock(TimeConverter freq, Clock::HandlerBase* handler);
 
+    /**
+       Puts a clock handler to sleep until the next event arrives on one of this (Sub)Component's links.  The handler
+       is deactivated immediately and is reactivated just before the first event handler for this (Sub)Component is
+       called, so it will fire again on the next cycle of its clock.  When no handlers are left active on a clock, the
+       clock is not rescheduled at all until one is reactivated.
+
+       This is meant to be called from inside the clock handler when it has no work left to do.  In that case, the
+       return value of the handler is ignored.
+
+       NOTE: Only events delivered to an event handler will wake the clock handler.  Events arriving on polling
+       links, or on links of other (Sub)Components, will not.
+
+       @param handler Handler to put to sleep.  Must already be registered using registerClock().
+    */
+    void sleepClockUntilEvent(Clock::HandlerBase* handler);
+
 
     /**
        Registers a clock handler for this component.
@@ -1314,6 +1330,31 @@ private:
     // core
     std::vector<Clock::HandlerBase*> clock_handlers_;
 
+    /**
+       Tool attached to all of the event handlers of this (Sub)Component once sleepClockUntilEvent() has been called.
+       Reactivates any sleeping clock handlers when an event is delivered.
+    */
+    class ClockWakeup : public Event::HandlerBase::AttachPoint, public SST::Core::Serialization::serializable
+    {
+    public:
+        ClockWakeup() = default;
+
+        void sleep(Clock::HandlerBase* handler) { sleeping_.push_back(handler); }
+
+        uintptr_t registerHandler(const AttachPointMetaData& UNUSED(mdata)) override { return 0; }
+        void      beforeHandler(uintptr_t key, const Event* ev) override;
+        void      afterHandler(uintptr_t UNUSED(key)) override {}
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) override { SST_SER(sleeping_); }
+        ImplementSerializable(SST::BaseComponent::ClockWakeup)
+
+    private:
+        std::vector<Clock::HandlerBase*> sleeping_;
+    };
+
+    // Created the first time sleepClockUntilEvent() is called
+    ClockWakeup* clock_wakeup_ = nullptr;
+
     void  addSelfLink(const std::string& name);
     Link* getLinkFromParentSharedPort(const std::string& port, std::vector<ConfigPortModule>& port_modules);
 
@@ -0,0 +1,235 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/checkpointBlob.h"
+
+#include "sst/core/output.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace SST::Checkpointing {
+
+namespace {
+
+// "SSTCPTZ1", identifies a compressed blob file.  An uncompressed
+// blob file starts with the size of its first section, which will
+// never be this large.
+constexpr uint64_t blob_magic = 0x315a545043545353ULL;
+
+// Runs func(i) for i in [0, count) using up to num_threads threads
+template <typename Func>
+void
+parallelFor(size_t count, int num_threads, Func func)
+{
+    size_t nthreads = std::min<size_t>(std::max(num_threads, 1), count);
+    if ( nthreads <= 1 ) {
+        for ( size_t i = 0; i < count; ++i )
+            func(i);
+        return;
+    }
+
+    std::atomic<size_t>      next(0);
+    std::vector<std::thread> workers;
+    auto                     work = [&]() {
+        for ( size_t i = next++; i < count; i = next++ )
+            func(i);
+    };
+    for ( size_t t = 1; t < nthreads; ++t )
+        workers.emplace_back(work);
+    work();
+    for ( auto& w : workers )
+        w.join();
+}
+
+} // namespace
+
+const char*
+blobCompressionCodec()
+{
+#ifdef HAVE_LIBZ
+    return "zlib";
+#else
+    return nullptr;
+#endif
+}
+
+std::vector<char>
+compressBlob(const std::vector<char>& image, size_t block_size, int num_threads)
+{
+#ifdef HAVE_LIBZ
+    size_t num_blocks = (image.size() + block_size - 1) / block_size;
+
+    std::vector<std::vector<char>> blocks(num_blocks);
+    parallelFor(num_blocks, num_threads, [&](size_t i) {
+        size_t offset = i * block_size;
+        uLong  len    = std::min(block_size, image.size() - offset);
+        uLongf dest   = compressBound(len);
+        blocks[i].resize(dest);
+        int ret = compress2(reinterpret_cast<Bytef*>(blocks[i].data()), &dest,
+            reinterpret_cast<const Bytef*>(image.data() + offset), len, Z_BEST_SPEED);
+        if ( ret != Z_OK ) {
+            Output::getDefaultObject().fatal(
+                CALL_INFO, 1, "ERROR: Compressing checkpoint data failed with zlib error %d\n", ret);
+        }
+        blocks[i].resize(dest);
+    });
+
+    std::vector<uint64_t> header = { blob_magic, block_size, image.size(), num_blocks };
+    for ( auto& block : blocks )
+        header.push_back(block.size());
+
+    std::vector<char> ret(header.size() * sizeof(uint64_t));
+    std::memcpy(ret.data(), header.data(), ret.size());
+    for ( auto& block : blocks )
+        ret.insert(ret.end(), block.begin(), block.end());
+    return ret;
+#else
+    (void)block_size;
+    (void)num_threads;
+    Output::getDefaultObject().fatal(
+        CALL_INFO, 1, "ERROR: Compressed checkpoints require SST to be built with a compression library (libz)\n");
+    return image;
+#endif
+}
+
+bool
+BlobFile::open(const std::string& filename, int num_threads)
+{
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if ( fd < 0 ) return false;
+
+    struct stat st;
+    if ( fstat(fd, &st) != 0 || st.st_size == 0 ) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t file_size = st.st_size;
+    void*  map       = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if ( map == MAP_FAILED ) return false;
+
+    uint64_t magic = 0;
+    if ( file_size >= sizeof(magic) ) std::memcpy(&magic, map, sizeof(magic));
+    if ( magic != blob_magic ) {
+        data_   = static_cast<char*>(map);
+        size_   = file_size;
+        mapped_ = true;
+        return true;
+    }
+
+    // Compressed, so decompress straight out of the mapping
+    bool ok = decompress(static_cast<const char*>(map), file_size, num_threads);
+    munmap(map, file_size);
+    if ( !ok ) {
+        close();
+        return false;
+    }
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    return true;
+}
+
+void
+BlobFile::close()
+{
+    if ( mapped_ ) munmap(data_, size_);
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+    data_     = nullptr;
+    size_     = 0;
+    mapped_   = false;
+    released_ = 0;
+}
+
+void
+BlobFile::releaseBefore(uint64_t offset)
+{
+    if ( !mapped_ ) return;
+
+    // Only whole pages can be released
+    static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+    uint64_t              end       = std::min<uint64_t>(offset, size_) / page_size * page_size;
+    if ( end <= released_ ) return;
+    madvise(data_ + released_, end - released_, MADV_DONTNEED);
+    released_ = end;
+}
+
+char*
+BlobFile::section(uint64_t& offset, size_t& size) const
+{
+    uint64_t start = offset;
+    if ( !read(start, size) || size > size_ - start ) return nullptr;
+    offset = start + size;
+    return data_ + start;
+}
+
+bool
+BlobFile::decompress(const char* file, size_t file_size, int num_threads)
+{
+#ifdef HAVE_LIBZ
+    // magic, block size, uncompressed size, number of blocks
+    uint64_t header[4];
+    if ( file_size < sizeof(header) ) return false;
+    std::memcpy(header, file, sizeof(header));
+
+    uint64_t block_size = header[1];
+    uint64_t num_blocks = header[3];
+    size_t   offset     = sizeof(header);
+    if ( num_blocks > (file_size - offset) / sizeof(uint64_t) ) return false;
+
+    std::vector<uint64_t> block_sizes(num_blocks);
+    std::memcpy(block_sizes.data(), file + offset, num_blocks * sizeof(uint64_t));
+    offset += num_blocks * sizeof(uint64_t);
+
+    std::vector<uint64_t> block_offsets(num_blocks);
+    for ( size_t i = 0; i < num_blocks; ++i ) {
+        block_offsets[i] = offset;
+        offset += block_sizes[i];
+    }
+    if ( offset > file_size ) return false;
+
+    buffer_.resize(header[2]);
+    std::atomic<bool> ok(true);
+    parallelFor(num_blocks, num_threads, [&](size_t i) {
+        size_t start = i * block_size;
+        uLongf len   = std::min<uint64_t>(block_size, buffer_.size() - start);
+        int    ret   = uncompress(reinterpret_cast<Bytef*>(buffer_.data() + start), &len,
+                 reinterpret_cast<const Bytef*>(file + block_offsets[i]), block_sizes[i]);
+        if ( ret != Z_OK ) ok = false;
+    });
+    return ok;
+#else
+    (void)file;
+    (void)file_size;
+    (void)num_threads;
+    Output::getDefaultObject().fatal(CALL_INFO, 1,
+        "ERROR: Checkpoint file is compressed, but SST was built without a compression library (libz)\n");
+    return false;
+#endif
+}
+
+} // namespace SST::Checkpointing
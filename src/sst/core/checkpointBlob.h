@@ -0,0 +1,124 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CHECKPOINT_BLOB_H
+#define SST_CORE_CHECKPOINT_BLOB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace SST::Checkpointing {
+
+/**
+   Name of the codec used to compress checkpoint blob files, or
+   nullptr if the core was built without a supported compression
+   library
+ */
+const char* blobCompressionCodec();
+
+/** Block size used when compressing checkpoint blob files */
+constexpr size_t blob_compression_block_size = 4 * 1024 * 1024;
+
+/**
+   Compress the image of a checkpoint blob file.  The image is split
+   into blocks of block_size bytes that are compressed independently,
+   using up to num_threads threads.  The result starts with a header
+   and an index of the compressed block sizes, so a reader can
+   decompress the blocks in parallel:
+
+     uint64_t magic
+     uint64_t block size
+     uint64_t uncompressed size
+     uint64_t number of blocks
+     uint64_t compressed size of each block
+     compressed blocks
+ */
+std::vector<char> compressBlob(const std::vector<char>& image, size_t block_size, int num_threads);
+
+/**
+   Read only view of a whole checkpoint blob file.  Uncompressed
+   files are mapped into memory, so each thread only touches the
+   pages of the components it restores and the data is unpacked
+   straight from the page cache instead of being read into a buffer
+   first.  Compressed files are recognized by their header and are
+   decompressed into memory using up to num_threads threads.  Either
+   way, offsets are into the uncompressed data, so the offsets in the
+   registry can be used for both types of file.
+
+   The mapping is private, so the data can be handed to the serializer
+   as a writable buffer without ever changing the file.
+ */
+class BlobFile
+{
+public:
+    BlobFile() = default;
+    explicit BlobFile(const std::string& filename, int num_threads = 1) { open(filename, num_threads); }
+    ~BlobFile() { close(); }
+
+    BlobFile(const BlobFile&)            = delete;
+    BlobFile& operator=(const BlobFile&) = delete;
+
+    bool open(const std::string& filename, int num_threads = 1);
+    bool is_open() const { return data_ != nullptr; }
+    void close();
+
+    /** Whether the open file was compressed */
+    bool isCompressed() const { return is_open() && !mapped_; }
+
+    char*  data() const { return data_; }
+    size_t size() const { return size_; }
+
+    /**
+       Get the section that starts at offset, which is a size_t
+       followed by that many bytes of data.  Sets size to the size of
+       the section, advances offset past it and returns a pointer to
+       its data.  Returns nullptr if the section runs past the end of
+       the file.
+     */
+    char* section(uint64_t& offset, size_t& size) const;
+
+    /**
+       Copy a value stored at offset and advance offset past it.
+       Returns false if the value runs past the end of the file.
+     */
+    template <typename T>
+    bool read(uint64_t& offset, T& value) const
+    {
+        if ( offset > size_ || size_ - offset < sizeof(T) ) return false;
+        std::memcpy(&value, data_ + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+
+    /**
+       Tell the OS that the data before offset won't be used again, so
+       the pages of a mapped file can be dropped as soon as the
+       components in them have been unpacked instead of holding the
+       whole file in memory alongside the restored components.
+     */
+    void releaseBefore(uint64_t offset);
+
+private:
+    bool decompress(const char* file, size_t file_size, int num_threads);
+
+    char*             data_   = nullptr;
+    size_t            size_     = 0;
+    bool              mapped_   = false;
+    uint64_t          released_ = 0;
+    std::vector<char> buffer_;
+};
+
+} // namespace SST::Checkpointing
+
+#endif // SST_CORE_CHECKPOINT_BLOB_H
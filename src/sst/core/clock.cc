@@ -62,31 +62,36 @@ Clock::registerHandler(Clock::HandlerBase* handler)
             "WARNING: Register Clock::Handler that is already active.  Handler will not be registered again.\n");
         return;
     }
-    handler->markAsActive(static_handler_map_.size());
-    static_handler_map_.push_back(handler);
+    addHandler(handler);
 
     if ( !scheduled_ ) {
         schedule();
     }
 }
 
+void
+Clock::addHandler(Clock::HandlerBase* handler)
+{
+    handler->markAsActive(handlers_.size());
+    handlers_.push_back(handler);
+    handler_funcs_.push_back(handler->dispatch_ != nullptr ? handler->dispatch_ : &Clock::callHandler);
+    handler_objects_.push_back(handler->object_ != nullptr ? handler->object_ : handler);
+    handler_active_.push_back(1);
+    active_count_++;
+}
+
 bool
 Clock::unregisterHandler(Clock::HandlerBase* handler, bool& empty)
 {
     if ( handler->active_ ) {
-        // Need to get index before marking it as inactive, which sets index to -1
-        int  index = handler->index_;
-        auto iter  = static_handler_map_.begin() + index;
-        iter       = static_handler_map_.erase(iter);
+        // Just flag the slot as inactive.  It will be removed the
+        // next time the clock fires.
+        handler_active_[handler->index_] = 0;
         handler->markAsInactive();
-
-        // Need to update the index for every handler below this one
-        for ( ; iter != static_handler_map_.end(); ++iter ) {
-            (*iter)->index_ = index++;
-        }
+        active_count_--;
     }
 
-    empty = static_handler_map_.empty();
+    empty = active_count_ == 0;
 
     return 0;
 }
@@ -97,8 +102,7 @@ Clock::registerHandler_restart(Clock::HandlerBase* handler)
     handler->clock_ = this;
     if ( !handler->active_ ) return;
 
-    handler->index_ = static_handler_map_.size();
-    static_handler_map_.push_back(handler);
+    addHandler(handler);
 
     if ( !scheduled_ ) {
         schedule();
@@ -108,11 +112,9 @@ Clock::registerHandler_restart(Clock::HandlerBase* handler)
 bool
 Clock::isHandlerRegistered(Clock::HandlerBase* handler)
 {
-    for ( auto* h : static_handler_map_ ) {
-        if ( h == handler ) return true;
-    }
-
-    return false;
+    int index = handler->index_;
+    return index >= 0 && static_cast<size_t>(index) < handlers_.size() && handlers_[index] == handler &&
+           handler_active_[index];
 }
 
 
@@ -129,7 +131,13 @@ Clock::execute()
 {
     Simulation* sim = Simulation::getSimulation();
 
-    if ( static_handler_map_.empty() ) {
+    if ( active_count_ == 0 ) {
+        // Clear out any handlers that were deactivated since the last
+        // time the clock fired
+        handlers_.clear();
+        handler_funcs_.clear();
+        handler_objects_.clear();
+        handler_active_.clear();
         scheduled_ = false;
         return;
     }
@@ -137,49 +145,52 @@ Clock::execute()
     // Derive the current cycle from the core time
     current_cycle_++;
 
-    auto sop_iter = static_handler_map_.begin();
-    for ( ; sop_iter != static_handler_map_.end(); ++sop_iter ) {
-        Clock::HandlerBase* handler = *sop_iter;
-
-        if ( (*handler)(current_cycle_) ) {
-            handler->markAsInactive();
-            // Just break here.  The handler has been marked inactive and the pointer will be overwritten or removed at
-            // the end as an empty slot.  This will break us into the compacting version of the iteration in the loop
-            // below
-            break;
+    // Call each active handler in order.  Inactive slots (handlers that returned true last cycle or were
+    // deactivated) are skipped, and active handlers are compacted down over them as we go, updating their index.
+    // Handlers can register or deactivate handlers on this clock while being called, so the size is checked each
+    // iteration and entries are only accessed by index.
+    size_t dst = 0;
+    for ( size_t src = 0; src < handlers_.size(); ++src ) {
+        if ( !handler_active_[src] ) continue;
+
+        Clock::HandlerBase* handler = handlers_[src];
+        if ( dst != src ) {
+            handlers_[dst]        = handler;
+            handler_funcs_[dst]   = handler_funcs_[src];
+            handler_objects_[dst] = handler_objects_[src];
+            handler_active_[dst]  = 1;
+            handler->index_       = dst;
         }
-    }
 
-    // Check to see if it finished all the handlers without any of them removing themselves.  As soon as the first
-    // handler removes itself, we drop out of the original loop and enter this one that will compact the rest of the
-    // entries then delete any empty spaces at the end. This gets rid of the need to constantly delete individual
-    // elements, doing multiple memcpy's of all entries below. This also allows us to update the index for each handler.
-    if ( sop_iter != static_handler_map_.end() ) {
-        // sop_iter becomes the location to copy to and we will start one past this calling the handler.  Then, we will
-        // copy the handler to the copy_iter and update its index.
-        auto   copy_iter = sop_iter; // Rename for clarity
-        size_t index     = copy_iter - static_handler_map_.begin();
-
-        for ( auto call_iter = sop_iter + 1; call_iter != static_handler_map_.end(); ++call_iter ) {
-            Clock::HandlerBase* handler = *call_iter;
-
-            if ( (*handler)(current_cycle_) ) {
-                // just mark as inactive.  The pointer will either get overwritten, or removed at the end as an empty
-                // slot
-                handler->markAsInactive();
-            }
-            else {
-                // Still active.  Need to copy up to copy_iter location and update the index
-                handler->index_ = index++;
-                *copy_iter      = *call_iter;
+        // Fetch the next handler's object while this one runs
+        if ( src + 1 < handlers_.size() ) __builtin_prefetch(handler_objects_[src + 1]);
 
-                // Advance the copy location
-                ++copy_iter;
+        if ( handler_funcs_[dst](handler, current_cycle_) ) {
+            // Handler asked to be removed.  Only need to mark it
+            // inactive if it didn't already deactivate or move itself
+            // while it was running.
+            if ( handler->index_ == static_cast<int>(dst) ) {
+                handler->markAsInactive();
+                active_count_--;
             }
         }
+        else if ( handler_active_[dst] ) {
+            ++dst;
+        }
+    }
+
+    // Remove the empty slots at the end
+    handlers_.resize(dst);
+    handler_funcs_.resize(dst);
+    handler_objects_.resize(dst);
+    handler_active_.resize(dst);
 
-        // Need to remove an empty locations in the vector
-        static_handler_map_.erase(copy_iter, static_handler_map_.end());
+    // If every handler removed itself or went to sleep, don't
+    // reschedule.  The clock will be scheduled again when a handler
+    // is registered.
+    if ( active_count_ == 0 ) {
+        scheduled_ = false;
+        return;
     }
 
     // Compute the next time to fire
@@ -226,7 +237,7 @@ Clock::toString() const
 {
     std::stringstream buf;
     buf << "Clock Activity with period " << period_.getFactor() << " to be delivered at " << getDeliveryTime()
-        << " with priority " << getPriority() << " with " << static_handler_map_.size() << " items on clock list";
+        << " with priority " << getPriority() << " with " << active_count_ << " items on clock list";
     return buf.str();
 }
 
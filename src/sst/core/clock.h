@@ -17,7 +17,9 @@
 #include "sst/core/timeConverter.h"
 
 #include <cinttypes>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
 #define _CLE_DBG(fmt, args...) __DBG(DBG_CLOCK, Clock, fmt, ##args)
@@ -55,6 +57,11 @@ public:
     public:
         HandlerBase() = default;
 
+        /**
+           Function Clock uses to call a handler without going through the vtable.  Set by Clock::Handler.
+        */
+        using DispatchFunc = bool (*)(HandlerBase*, Cycle_t);
+
         void serialize_order(SST::Core::Serialization::serializer& ser) override
         {
             SSTHandlerBase<bool, Cycle_t>::serialize_order(ser);
@@ -125,6 +132,19 @@ public:
         */
         int index_ = -1;
 
+    protected:
+        /**
+           Function used by Clock to call the handler directly.  If not set, Clock will call the handler through
+           operator().
+        */
+        DispatchFunc dispatch_ = nullptr;
+
+        /**
+           Object the handler will be called on.  Only used by Clock to prefetch the object before it is called.
+        */
+        void* object_ = nullptr;
+
+    private:
         /**
            Mark the handler as active
         */
@@ -168,7 +188,45 @@ public:
        handler will be left in the clock list.
     */
     template <typename classT, auto funcT, typename dataT = void>
-    using Handler = SSTHandler<bool, Cycle_t, classT, dataT, funcT, HandlerBase>;
+    class Handler final : public SSTHandler<bool, Cycle_t, classT, dataT, funcT, HandlerBase>
+    {
+        using Base = SSTHandler<bool, Cycle_t, classT, dataT, funcT, HandlerBase>;
+
+    public:
+        /** Constructor
+         * @param object - Pointer to Object upon which to call the handler
+         * @param data - Additional argument to pass to handler, if dataT is not void
+         */
+        template <typename... Args>
+        explicit Handler(classT* const object, Args&&... data) :
+            Base(object, std::forward<Args>(data)...)
+        {
+            this->dispatch_ = &Handler::dispatch;
+            this->object_   = object;
+        }
+
+        Handler() :
+            Base()
+        {
+            this->dispatch_ = &Handler::dispatch;
+        }
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) override
+        {
+            Base::serialize_order(ser);
+            // Base serializes the object itself, this just restores the copy used for prefetching
+            classT* object = static_cast<classT*>(this->object_);
+            SST_SER(object);
+            this->object_ = object;
+        }
+
+        ImplementSerializable(Handler)
+
+    private:
+        // Handler is final, so the call to operator_impl() inside operator() can be resolved without the vtable.
+        // operator() still takes care of any attached tools.
+        static bool dispatch(HandlerBase* handler, Cycle_t cycle) { return (*static_cast<Handler*>(handler))(cycle); }
+    };
 
     /**
        Handler2 version which is now the same as Handler and is provided for backward compatibility until SST 17
@@ -176,7 +234,7 @@ public:
     template <typename classT, auto funcT, typename dataT = void>
     using Handler2 [[deprecated(
         "The name Handler2 has been deprecated and will be removed in SST 17. Please rename Handler2 to Handler.")]]
-    = SSTHandler<bool, Cycle_t, classT, dataT, funcT, HandlerBase>;
+    = Handler<classT, funcT, dataT>;
 
     /**
      * Activates this clock object, by inserting into the simulation's
@@ -222,8 +280,6 @@ public:
     TimeConverter getPeriod() { return period_; }
 
 private:
-    using StaticHandlerMap_t = std::vector<Clock::HandlerBase*>;
-
     Clock() {}
 
     Clock(const Clock&)            = delete;
@@ -231,11 +287,30 @@ private:
 
     void execute() override;
 
-    Cycle_t            current_cycle_;
-    TimeConverter      period_;
-    StaticHandlerMap_t static_handler_map_;
-    SimTime_t          next_;
-    bool               scheduled_;
+    /**
+       Add handler to the end of the handler arrays
+    */
+    void addHandler(Clock::HandlerBase* handler);
+
+    /**
+       Used for handlers that don't provide a DispatchFunc
+    */
+    static bool callHandler(Clock::HandlerBase* handler, Cycle_t cycle) { return (*handler)(cycle); }
+
+    Cycle_t       current_cycle_;
+    TimeConverter period_;
+
+    // Handlers are stored as a struct of arrays, indexed by the handler's index_, so the execute loop only touches
+    // what it needs for each handler.  Handlers that are deactivated are only flagged as inactive and are removed
+    // the next time the clock fires, which keeps the handlers in the order they were registered.
+    std::vector<Clock::HandlerBase*>       handlers_;
+    std::vector<HandlerBase::DispatchFunc> handler_funcs_;
+    std::vector<void*>                     handler_objects_;
+    std::vector<uint8_t>                   handler_active_;
+    size_t                                 active_count_ = 0;
+
+    SimTime_t next_;
+    bool      scheduled_;
 
     void serialize_order(SST::Core::Serialization::serializer& ser) override;
     ImplementSerializable(SST::Clock)
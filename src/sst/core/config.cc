@@ -440,6 +440,10 @@ Config::insertOptions()
         exit_after_, true, false, false);
     DEF_ARG("partitioner", 0, "PARTITIONER", "Select the partitioner to be used. <lib.partitionerName>", partitioner_,
         true, false, false);
+    DEF_ARG("partitioner-profile", 0, "FILE",
+        "Profile file for the sst.profile partitioner, as written by the profile.handler.event.partition profile tool. "
+        "If FILE does not exist, the per rank files FILE.0, FILE.1, ... are read instead.",
+        partitioner_profile_, true, false, false);
     DEF_ARG("heartbeat-period", 0, "PERIOD",
         "Set time for heartbeats to be published (these are approximate timings measured in simulation time, published "
         "by the core, to update on progress)",
@@ -502,6 +506,27 @@ Config::insertOptions()
         "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>", timeVortex_, true, true, false);
     DEF_FLAG_OPTVAL("interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used",
         interthread_links_, true);
+    DEF_FLAG_OPTVAL("batch-dispatch", 0,
+        "[EXPERIMENTAL] Set whether all activities with the same delivery time and priority are popped from the "
+        "TimeVortex together and executed as a batch, with signal checks done once per batch.  Activities inserted for "
+        "the current time and priority while a batch is running are executed after the batch",
+        batch_dispatch_, true, true);
+    DEF_FLAG_OPTVAL("rank-sync-overlap", 0,
+        "[EXPERIMENTAL] Set whether the data exchanged at a rank sync is delivered at the following sync instead of "
+        "waiting for it to arrive.  Ranks sync twice as often, but continue executing events while the data is in "
+        "flight.  Only used when running one thread per rank",
+        rank_sync_overlap_, true, true);
+    DEF_FLAG_OPTVAL("rank-sync-pairwise", 0,
+        "[EXPERIMENTAL] Set whether each pair of neighboring ranks syncs at a rate set by the lowest latency link "
+        "between them instead of all ranks syncing at the rate set by the lowest latency link in the simulation.  "
+        "Global syncs still happen at the rate of the slowest pair.  Only used when running one thread per rank and "
+        "takes precedence over --rank-sync-overlap",
+        rank_sync_pairwise_, true, true);
+    DEF_FLAG_OPTVAL("dissemination-barrier", 0,
+        "[EXPERIMENTAL] Set whether the thread syncs use a dissemination barrier, where each thread waits on its own "
+        "cache line, instead of a barrier where all threads update and wait on a single shared counter.  Reduces "
+        "barrier latency when running many threads per rank",
+        dissemination_barrier_, true, true);
 #ifdef USE_MEMPOOL
     DEF_FLAG_OPTVAL("cache-align-mempools", 0, "[EXPERIMENTAL] Set whether mempool allocations are cache aligned",
         cache_align_mempools_, true, true, true);
@@ -596,6 +621,22 @@ Config::insertOptions()
         "Set the format for checkpoint filenames. See extended help for format options.  Default is "
         "\"%p_%n_%t/%p_%n_%t\"",
         checkpoint_name_format_, true, false, false);
+    DEF_FLAG_OPTVAL("checkpoint-async", 0,
+        "[EXPERIMENTAL] Set whether checkpoint files are written in the background.  The state for each partition is "
+        "packed into memory and the simulation continues while a separate thread writes it to disk.  This needs "
+        "enough memory to hold a copy of the partition's checkpoint",
+        checkpoint_async_, true, true);
+    DEF_FLAG_OPTVAL("checkpoint-incremental", 0,
+        "[EXPERIMENTAL] Set whether checkpoints after the first only write the components whose checkpoint data has "
+        "changed since the previous checkpoint.  The other components are referenced in the earlier checkpoint "
+        "directories, so those directories must be kept to restart from a later checkpoint",
+        checkpoint_incremental_, true, true);
+#ifdef HAVE_LIBZ
+    DEF_FLAG_OPTVAL("checkpoint-compress", 0,
+        "[EXPERIMENTAL] Set whether checkpoint blob files are compressed (zlib).  The files are compressed in blocks "
+        "that are compressed and decompressed in parallel",
+        checkpoint_compress_, true, true);
+#endif
 
     enableDashDashSupport(std::bind(&OptionDefinition::parse, &model_options_, _1));
     addPositionalCallback(std::bind(&Config::positionalCallback, this, _1, _2));
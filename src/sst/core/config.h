@@ -202,6 +202,12 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(std::string, partitioner, "sst.linear", &StandardConfigParsers::element_name);
 
+    /**
+       Profile file written by the profile.handler.event.partition
+       profile tool, used by the sst.profile partitioner
+    */
+    SST_CONFIG_DECLARE_OPTION(std::string, partitioner_profile, "", &StandardConfigParsers::from_string<std::string>);
+
     /**
        Wall-clock period at which to print out a "heartbeat" message
     */
@@ -390,6 +396,27 @@ private:
     */
     SST_CONFIG_DECLARE_OPTION(bool, interthread_links, false, &StandardConfigParsers::flag_default_true);
 
+    /**
+       Pop activities with the same delivery time and priority from
+       the TimeVortex as a batch and execute them back to back
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, batch_dispatch, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Overlap the rank sync exchange with event processing
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, rank_sync_overlap, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Track the sync lookahead separately for each pair of ranks
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, rank_sync_pairwise, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Use a dissemination barrier in the thread syncs
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, dissemination_barrier, false, &StandardConfigParsers::flag_default_true);
+
 
 #ifdef USE_MEMPOOL
     /**
@@ -615,6 +642,24 @@ private:
         std::bind(&Config::parse_checkpoint_name_format, std::placeholders::_1, std::placeholders::_2),
         &Config::ext_help_checkpoint_format);
 
+    /**
+       Write checkpoint files from a background thread so the
+       simulation can continue as soon as the state has been packed
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_async, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Only write the components that have changed since the previous
+       checkpoint
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_incremental, false, &StandardConfigParsers::flag_default_true);
+
+    /**
+       Compress checkpoint blob files.  Only available if SST was built
+       with a compression library.
+    */
+    SST_CONFIG_DECLARE_OPTION(bool, checkpoint_compress, false, &StandardConfigParsers::flag_default_true);
+
 public:
 
     /** Get whether or not any of the checkpoint options were turned on */
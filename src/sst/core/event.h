@@ -20,6 +20,8 @@
 #include <cinttypes>
 #include <cstdint>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 namespace SST {
@@ -119,6 +121,27 @@ public:
     /** Clones the event in for the case of a broadcast */
     virtual Event* clone();
 
+    /**
+       Events whose data can be moved between ranks with memcpy() can
+       override this to skip serialize_order() when they are sent over
+       a link that crosses ranks.  The event is rebuilt on the remote
+       rank by default constructing the class and copying the payload
+       back into the location returned by this function.
+
+       This should only be overridden by the most derived class and
+       only if the payload covers all of the state that the event
+       needs, beyond what is in Event.  Events with no additional
+       state can return true with a size of 0.
+
+       @param[out] payload Set to the location of the payload
+
+       @param[out] size Set to the size of the payload in bytes
+
+       @return true if the payload is trivially copyable, false if the
+       event needs to be serialized
+     */
+    virtual bool getTrivialPayload(void*& UNUSED(payload), size_t& UNUSED(size)) { return false; }
+
 
 #ifdef __SST_DEBUG_EVENT_TRACKING__
 
@@ -190,6 +213,7 @@ private:
     friend class NullEvent;
     friend class RankSync;
     friend class ThreadSync;
+    friend class RankSyncQueue;
     friend class TimeVortex;
     friend class Simulation;
 
@@ -309,6 +333,20 @@ public:
     /** Clone a BasicEvent */
     Event* clone() override { return new BasicEvent(*this); }
 
+    bool getTrivialPayload(void*& payload, size_t& size) override
+    {
+        if constexpr ( std::is_trivially_copyable_v<dataT> ) {
+            // A class derived from BasicEvent may add state that isn't
+            // covered by data
+            if ( typeid(*this) != typeid(BasicEvent) ) return false;
+            payload = &data;
+            size    = sizeof(data);
+            return true;
+        }
+        else {
+            return false;
+        }
+    }
 
     dataT data;
 
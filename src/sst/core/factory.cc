@@ -41,6 +41,7 @@
 #include "sst/core/statapi/statbase.h"
 #include "sst/core/statapi/stathistogram.h"
 #include "sst/core/statapi/statnull.h"
+#include "sst/core/statapi/statquantile.h"
 #include "sst/core/statapi/statuniquecount.h"
 
 using namespace SST::Statistics;
@@ -0,0 +1,145 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/latencypart.h"
+
+#include "sst/core/model/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation.h"
+#include "sst/core/timeLord.h"
+#include "sst/core/unitAlgebra.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+using namespace SST::IMPL::Partition;
+
+SSTLatencyPartition::SSTLatencyPartition(RankInfo rankCount, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTMultilevelPartition(rankCount, verbosity, "LookaheadPartition ")
+{}
+
+size_t
+SSTLatencyPartition::contractBelow(const Graph& graph, SimTime_t threshold, std::vector<uint32_t>& cmap)
+{
+    // Union-find over the edges below the threshold
+    std::vector<uint32_t> parent(graph.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](uint32_t v) {
+        while ( parent[v] != v ) {
+            parent[v] = parent[parent[v]];
+            v         = parent[v];
+        }
+        return v;
+    };
+    for ( uint32_t v = 0; v < graph.size(); ++v ) {
+        for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; ++j ) {
+            if ( graph.adjlat[j] >= threshold ) continue;
+            uint32_t a = find(v);
+            uint32_t b = find(graph.adjncy[j]);
+            if ( a != b ) parent[std::max(a, b)] = std::min(a, b);
+        }
+    }
+
+    // Number the groups in order of their lowest vertex
+    size_t                cn = 0;
+    std::vector<uint32_t> id(graph.size(), std::numeric_limits<uint32_t>::max());
+    cmap.resize(graph.size());
+    for ( uint32_t v = 0; v < graph.size(); ++v ) {
+        uint32_t root = find(v);
+        if ( id[root] == std::numeric_limits<uint32_t>::max() ) id[root] = cn++;
+        cmap[v] = id[root];
+    }
+    return cn;
+}
+
+void
+SSTLatencyPartition::performPartition(PartitionGraph* graph)
+{
+    uint32_t nparts = rankcount.rank * rankcount.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a lookahead partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", graph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Partitions:                       %10" PRIu32 "\n", nparts);
+
+    std::vector<PartitionComponent*> vertices;
+    Graph                            g        = buildGraph(graph, vertices);
+    double                           max_pwgt = maxPartWeight(g, nparts);
+
+    // Only links at or above the threshold can be cut, so the
+    // candidate thresholds are the distinct link latencies.  The
+    // lowest one doesn't contract anything.
+    std::vector<SimTime_t> latencies(g.adjlat);
+    std::sort(latencies.begin(), latencies.end());
+    latencies.erase(std::unique(latencies.begin(), latencies.end()), latencies.end());
+
+    std::vector<uint32_t> parts(g.size(), 0);
+    SimTime_t             threshold = 0;
+    if ( nparts > 1 && !latencies.empty() ) {
+        // Raising the threshold only ever merges groups, so binary
+        // search for the highest threshold where no group is too heavy
+        // to fit in a part
+        std::vector<uint32_t> cmap;
+        auto                  feasible = [&](SimTime_t candidate) {
+            size_t              cn = contractBelow(g, candidate, cmap);
+            std::vector<double> wgt(cn, 0.0);
+            for ( size_t v = 0; v < g.size(); ++v )
+                wgt[cmap[v]] += g.vwgt[v];
+            return *std::max_element(wgt.begin(), wgt.end()) <= max_pwgt;
+        };
+        size_t lo = 0;
+        size_t hi = latencies.size() - 1;
+        while ( lo < hi ) {
+            size_t mid = (lo + hi + 1) / 2;
+            if ( feasible(latencies[mid]) )
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        // Groups that each fit in a part may still not pack into a
+        // balanced partition, so back off the threshold until they do
+        for ( size_t i = lo + 1; i-- > 0; ) {
+            threshold                   = latencies[i];
+            size_t                cn    = contractBelow(g, threshold, cmap);
+            Graph                 cg    = contractGraph(g, cmap, cn);
+            std::vector<uint32_t> cpart = partitionGraph(cg, nparts, max_pwgt);
+
+            std::vector<double> pwgt(nparts, 0.0);
+            for ( size_t v = 0; v < g.size(); ++v ) {
+                parts[v] = cpart[cmap[v]];
+                pwgt[parts[v]] += g.vwgt[v];
+            }
+            if ( *std::max_element(pwgt.begin(), pwgt.end()) <= max_pwgt ) break;
+            partOutput->verbose(CALL_INFO, 2, 0, "- Threshold %" PRIu64 " could not be balanced\n", threshold);
+        }
+    }
+    assignRanks(vertices, parts);
+
+    // The lookahead is the lowest latency of any cut link
+    SimTime_t lookahead = MAX_SIMTIME_T;
+    for ( size_t v = 0; v < g.size(); ++v )
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j )
+            if ( parts[g.adjncy[j]] != parts[v] ) lookahead = std::min(lookahead, g.adjlat[j]);
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- No-cut latency threshold:         %10" PRIu64 "\n", threshold);
+    if ( lookahead == MAX_SIMTIME_T ) {
+        partOutput->verbose(CALL_INFO, 1, 0, "- Achieved lookahead:               no links cut\n");
+    }
+    else {
+        UnitAlgebra time = Simulation::getTimeLord()->getTimeBase() * lookahead;
+        partOutput->verbose(CALL_INFO, 1, 0, "- Achieved lookahead:               %10s (%" PRIu64 " core cycles)\n",
+            time.toStringBestSI().c_str(), lookahead);
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "Lookahead partition scheme completed.\n");
+}
@@ -0,0 +1,66 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_LATENCYPART_H
+#define SST_CORE_IMPL_PARTITONERS_LATENCYPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+namespace SST::IMPL::Partition {
+
+/**
+   Latency aware version of the multilevel partitioner.  The lookahead
+   between partitions is set by the lowest latency link that is cut,
+   so this partitioner picks a latency threshold and treats every link
+   below it as a no-cut link.  The threshold is the highest link
+   latency that still lets the resulting groups of components be
+   balanced across the partitions.  The groups are then partitioned
+   with the multilevel partitioner and the achieved lookahead is
+   reported.
+*/
+class SSTLatencyPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTLatencyPartition,
+        "sst",
+        "lookahead",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that never cuts links below a latency threshold.  The threshold is chosen to "
+        "maximize the lookahead between partitions while keeping the partitions balanced.")
+
+    /**
+       Creates a new latency aware partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTLatencyPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+private:
+    /**
+       Contract every edge of graph with a latency below threshold.
+       Sets cmap to the contracted vertex of each vertex and returns
+       the number of contracted vertices.
+     */
+    size_t contractBelow(const Graph& graph, SimTime_t threshold, std::vector<uint32_t>& cmap);
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_LATENCYPART_H
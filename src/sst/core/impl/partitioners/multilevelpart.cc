@@ -0,0 +1,477 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/model/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+using namespace SST::IMPL::Partition;
+
+namespace {
+
+using Graph = SSTMultilevelPartition::Graph;
+
+// No part may be more than this much heavier than the average
+constexpr double   imbalance_tolerance        = 1.03;
+// Coarsening stops once there are this many vertices per part
+constexpr size_t   coarsest_vertices_per_part = 20;
+// Maximum number of refinement passes at each level
+constexpr int      max_refinement_passes      = 8;
+constexpr uint32_t unassigned                 = std::numeric_limits<uint32_t>::max();
+
+// Runs func(thread, begin, end) over [0, count) split into one
+// contiguous range per thread.  Small ranges aren't worth a thread.
+template <typename Func>
+void
+parallelRanges(size_t count, int num_threads, Func func)
+{
+    size_t nthreads = std::min<size_t>(std::max(num_threads, 1), std::max<size_t>(count / 1024, 1));
+    size_t chunk    = (count + nthreads - 1) / nthreads;
+
+    std::vector<std::thread> workers;
+    for ( size_t t = 1; t < nthreads; ++t )
+        workers.emplace_back(func, t, std::min(t * chunk, count), std::min((t + 1) * chunk, count));
+    func(0, 0, std::min(chunk, count));
+    for ( auto& w : workers )
+        w.join();
+}
+
+double
+totalWeight(const Graph& graph)
+{
+    return std::accumulate(graph.vwgt.begin(), graph.vwgt.end(), 0.0);
+}
+
+// Collapse a heavy edge matching of graph.  Vertices are visited in
+// random order and each unmatched vertex is matched with the unmatched
+// neighbor it has the heaviest edge to, as long as the combined vertex
+// isn't heavier than max_vwgt.  Sets cmap to the coarse vertex of each
+// vertex of graph.
+Graph
+coarsen(const Graph& graph, double max_vwgt, std::mt19937& rng, std::vector<uint32_t>& cmap)
+{
+    size_t                n = graph.size();
+    std::vector<uint32_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    std::vector<uint32_t> match(n, unassigned);
+    uint32_t              cn = 0;
+    cmap.assign(n, 0);
+    for ( uint32_t v : order ) {
+        if ( match[v] != unassigned ) continue;
+        uint32_t best     = v;
+        double   best_wgt = 0.0;
+        for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; ++j ) {
+            uint32_t u = graph.adjncy[j];
+            if ( match[u] != unassigned || graph.adjwgt[j] <= best_wgt ) continue;
+            if ( graph.vwgt[v] + graph.vwgt[u] > max_vwgt ) continue;
+            best     = u;
+            best_wgt = graph.adjwgt[j];
+        }
+        match[v]    = best;
+        match[best] = v;
+        cmap[v]     = cmap[best] = cn++;
+    }
+    return SSTMultilevelPartition::contractGraph(graph, cmap, cn);
+}
+
+// Partition the coarsest graph by growing one region at a time.  Each
+// region starts at the heaviest unassigned vertex and repeatedly adds
+// the unassigned vertex most strongly connected to it until it has its
+// share of the remaining weight.  Whatever is left goes in the last
+// part.
+std::vector<uint32_t>
+initialPartition(const Graph& graph, uint32_t nparts)
+{
+    size_t                n = graph.size();
+    std::vector<uint32_t> part(n, unassigned);
+
+    std::vector<uint32_t> seeds(n);
+    std::iota(seeds.begin(), seeds.end(), 0);
+    std::stable_sort(
+        seeds.begin(), seeds.end(), [&graph](uint32_t a, uint32_t b) { return graph.vwgt[a] > graph.vwgt[b]; });
+    size_t next_seed = 0;
+
+    std::vector<double>   conn(n, 0.0);
+    std::vector<uint32_t> touched;
+    double                remaining = totalWeight(graph);
+    for ( uint32_t p = 0; p + 1 < nparts; ++p ) {
+        double target = remaining / (nparts - p);
+        double weight = 0.0;
+
+        std::priority_queue<std::pair<double, uint32_t>> frontier;
+        while ( weight < target ) {
+            uint32_t v;
+            if ( !frontier.empty() ) {
+                v = frontier.top().second;
+                frontier.pop();
+                if ( part[v] != unassigned ) continue;
+            }
+            else {
+                while ( next_seed < n && part[seeds[next_seed]] != unassigned )
+                    ++next_seed;
+                if ( next_seed == n ) break;
+                v = seeds[next_seed];
+            }
+            // Stop short if adding v would overshoot the target by
+            // more than leaving it out undershoots it
+            if ( weight > 0.0 && weight + graph.vwgt[v] - target > target - weight ) break;
+
+            part[v] = p;
+            weight += graph.vwgt[v];
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; ++j ) {
+                uint32_t u = graph.adjncy[j];
+                if ( part[u] != unassigned ) continue;
+                if ( conn[u] == 0.0 ) touched.push_back(u);
+                conn[u] += graph.adjwgt[j];
+                frontier.emplace(conn[u], u);
+            }
+        }
+        remaining -= weight;
+        for ( uint32_t u : touched )
+            conn[u] = 0.0;
+        touched.clear();
+    }
+
+    for ( auto& p : part )
+        if ( p == unassigned ) p = nparts - 1;
+    return part;
+}
+
+// Greedy k-way refinement.  Each pass computes the best move for every
+// vertex in parallel, using the partition from the start of the pass.
+// The moves are then applied serially, best gain first, after checking
+// that the gain still holds and that the move doesn't make a part
+// heavier than max_pwgt.  Moves with no gain are taken if they improve
+// the balance, and moves out of an overweight part are taken
+// regardless of gain.
+void
+refine(const Graph& graph, uint32_t nparts, std::vector<uint32_t>& part, double max_pwgt, int num_threads)
+{
+    struct Move
+    {
+        double   gain;
+        uint32_t v;
+        uint32_t to;
+    };
+
+    size_t n = graph.size();
+
+    std::vector<double> pwgt(nparts, 0.0);
+    for ( size_t v = 0; v < n; ++v )
+        pwgt[part[v]] += graph.vwgt[v];
+
+    std::vector<std::vector<Move>> thread_moves(std::max(num_threads, 1));
+    std::vector<Move>              moves;
+    for ( int pass = 0; pass < max_refinement_passes; ++pass ) {
+        uint32_t lightest = std::min_element(pwgt.begin(), pwgt.end()) - pwgt.begin();
+
+        parallelRanges(n, num_threads, [&](size_t t, size_t begin, size_t end) {
+            auto& local = thread_moves[t];
+            local.clear();
+            std::vector<double>   conn(nparts, 0.0);
+            std::vector<uint32_t> touched;
+            for ( size_t v = begin; v < end; ++v ) {
+                uint32_t from = part[v];
+                for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; ++j ) {
+                    uint32_t p = part[graph.adjncy[j]];
+                    if ( conn[p] == 0.0 ) touched.push_back(p);
+                    conn[p] += graph.adjwgt[j];
+                }
+                double   internal   = conn[from];
+                bool     overweight = pwgt[from] > max_pwgt;
+                uint32_t best       = from;
+                double   best_gain  = -std::numeric_limits<double>::max();
+                for ( uint32_t p : touched ) {
+                    if ( p == from ) continue;
+                    double gain = conn[p] - internal;
+                    if ( gain > best_gain || (gain == best_gain && pwgt[p] < pwgt[best]) ) {
+                        best      = p;
+                        best_gain = gain;
+                    }
+                }
+                for ( uint32_t p : touched )
+                    conn[p] = 0.0;
+                touched.clear();
+
+                if ( best != from &&
+                     (best_gain > 0.0 || (best_gain == 0.0 && pwgt[best] + graph.vwgt[v] < pwgt[from]) || overweight) )
+                    local.push_back({ best_gain, static_cast<uint32_t>(v), best });
+                else if ( overweight && lightest != from )
+                    local.push_back({ -internal, static_cast<uint32_t>(v), lightest });
+            }
+        });
+
+        moves.clear();
+        for ( auto& local : thread_moves )
+            moves.insert(moves.end(), local.begin(), local.end());
+        std::stable_sort(moves.begin(), moves.end(), [](const Move& a, const Move& b) { return a.gain > b.gain; });
+
+        size_t moved = 0;
+        for ( const Move& m : moves ) {
+            uint32_t from = part[m.v];
+            double   vwgt = graph.vwgt[m.v];
+            if ( pwgt[m.to] + vwgt > max_pwgt ) continue;
+
+            // Earlier moves may have changed the gain
+            double gain = 0.0;
+            for ( size_t j = graph.xadj[m.v]; j < graph.xadj[m.v + 1]; ++j ) {
+                uint32_t p = part[graph.adjncy[j]];
+                if ( p == m.to )
+                    gain += graph.adjwgt[j];
+                else if ( p == from )
+                    gain -= graph.adjwgt[j];
+            }
+            if ( !(gain > 0.0 || (gain == 0.0 && pwgt[m.to] + vwgt < pwgt[from]) || pwgt[from] > max_pwgt) ) continue;
+
+            part[m.v] = m.to;
+            pwgt[from] -= vwgt;
+            pwgt[m.to] += vwgt;
+            ++moved;
+        }
+        if ( moved == 0 ) break;
+    }
+}
+
+} // namespace
+
+SSTMultilevelPartition::Graph
+SSTMultilevelPartition::contractGraph(const Graph& graph, const std::vector<uint32_t>& cmap, size_t cn)
+{
+    // Group the vertices by the vertex they are contracted into
+    std::vector<size_t>   start(cn + 1, 0);
+    std::vector<uint32_t> members(graph.size());
+    for ( uint32_t cv : cmap )
+        start[cv + 1]++;
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    std::vector<size_t> next(start.begin(), start.end() - 1);
+    for ( uint32_t v = 0; v < graph.size(); ++v )
+        members[next[cmap[v]]++] = v;
+
+    // Merge the edges of the members.  where[cu] is the index of the
+    // edge to cu if it has already been added for the current vertex.
+    Graph               coarse;
+    std::vector<size_t> where(cn, std::numeric_limits<size_t>::max());
+    coarse.vwgt.assign(cn, 0.0);
+    coarse.xadj.reserve(cn + 1);
+    coarse.xadj.push_back(0);
+    for ( uint32_t cv = 0; cv < cn; ++cv ) {
+        size_t first = coarse.adjncy.size();
+        for ( size_t m = start[cv]; m < start[cv + 1]; ++m ) {
+            uint32_t v = members[m];
+            coarse.vwgt[cv] += graph.vwgt[v];
+            for ( size_t j = graph.xadj[v]; j < graph.xadj[v + 1]; ++j ) {
+                uint32_t cu = cmap[graph.adjncy[j]];
+                if ( cu == cv ) continue;
+                if ( where[cu] != std::numeric_limits<size_t>::max() && where[cu] >= first ) {
+                    coarse.adjwgt[where[cu]] += graph.adjwgt[j];
+                    continue;
+                }
+                where[cu] = coarse.adjncy.size();
+                coarse.adjncy.push_back(cu);
+                coarse.adjwgt.push_back(graph.adjwgt[j]);
+            }
+        }
+        coarse.xadj.push_back(coarse.adjncy.size());
+    }
+    return coarse;
+}
+
+double
+SSTMultilevelPartition::maxPartWeight(const Graph& graph, uint32_t nparts)
+{
+    double avg   = totalWeight(graph) / nparts;
+    double max_v = graph.size() ? *std::max_element(graph.vwgt.begin(), graph.vwgt.end()) : 0.0;
+    return std::max(avg * imbalance_tolerance, avg + max_v);
+}
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo rankCount, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTMultilevelPartition(rankCount, verbosity, "MultilevelPartition ")
+{}
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo rankCount, int verbosity, const std::string& prefix) :
+    rankcount(rankCount),
+    num_threads(std::max(1u, std::thread::hardware_concurrency()))
+{
+    partOutput = new Output(prefix, verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+SSTMultilevelPartition::Graph
+SSTMultilevelPartition::buildGraph(PartitionGraph* graph, std::vector<PartitionComponent*>& vertices)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = graph->getLinkMap();
+
+    Graph result;
+    vertices.clear();
+
+    // Each link shows up in the link lists of the two components it
+    // connects.  Remember the first one until the second one is found.
+    std::unordered_map<LinkId_t, uint32_t>                         first_end;
+    std::vector<std::tuple<uint32_t, uint32_t, double, SimTime_t>> edges;
+    for ( PartitionComponentMap_t::iterator compItr = compMap.begin(); compItr != compMap.end(); compItr++ ) {
+        uint32_t v = vertices.size();
+        vertices.push_back(*compItr);
+        result.vwgt.push_back(componentWeight(*compItr));
+
+        for ( LinkIdMap_t::iterator linkItr = (*compItr)->links.begin(); linkItr != (*compItr)->links.end();
+              linkItr++ ) {
+            auto end = first_end.find(*linkItr);
+            if ( end == first_end.end() ) {
+                first_end.emplace(*linkItr, v);
+                continue;
+            }
+            if ( end->second != v ) {
+                SimTime_t lat = linkMap[*linkItr].getMinLatency();
+                double    wgt = linkWeight(linkMap[*linkItr]);
+                edges.emplace_back(end->second, v, wgt, lat);
+                edges.emplace_back(v, end->second, wgt, lat);
+            }
+            first_end.erase(end);
+        }
+    }
+
+    // Without any weights, balance the number of components
+    if ( totalWeight(result) <= 0.0 ) std::fill(result.vwgt.begin(), result.vwgt.end(), 1.0);
+
+    // Combine parallel links into a single edge
+    std::sort(edges.begin(), edges.end());
+    result.xadj.assign(vertices.size() + 1, 0);
+    for ( size_t i = 0; i < edges.size(); ++i ) {
+        auto [a, b, wgt, lat] = edges[i];
+        if ( i > 0 && std::get<0>(edges[i - 1]) == a && std::get<1>(edges[i - 1]) == b ) {
+            result.adjwgt.back() += wgt;
+            result.adjlat.back() = std::min(result.adjlat.back(), lat);
+            continue;
+        }
+        result.adjncy.push_back(b);
+        result.adjwgt.push_back(wgt);
+        result.adjlat.push_back(lat);
+        result.xadj[a + 1]++;
+    }
+    std::partial_sum(result.xadj.begin(), result.xadj.end(), result.xadj.begin());
+    return result;
+}
+
+std::vector<uint32_t>
+SSTMultilevelPartition::partitionGraph(const Graph& graph, uint32_t nparts, double max_pwgt)
+{
+    if ( nparts <= 1 || graph.size() == 0 ) return std::vector<uint32_t>(graph.size(), 0);
+
+    // The balance limit comes from the finest graph, since the coarse
+    // vertices are too heavy to balance by themselves
+    if ( max_pwgt <= 0.0 ) max_pwgt = maxPartWeight(graph, nparts);
+
+    // Fixed seed so the partition is the same from run to run
+    std::mt19937 rng(5489u);
+
+    // Coarsen until the graph is small enough or matching stops making
+    // progress.  Limiting the weight of a coarse vertex keeps the
+    // coarsest graph balanceable.
+    std::vector<Graph>                 levels;
+    std::vector<std::vector<uint32_t>> cmaps;
+    const Graph*                       current  = &graph;
+    size_t                             target   = coarsest_vertices_per_part * nparts;
+    double                             max_vwgt = 1.5 * totalWeight(graph) / target;
+    while ( current->size() > target ) {
+        std::vector<uint32_t> cmap;
+        Graph                 coarse = coarsen(*current, max_vwgt, rng, cmap);
+        if ( coarse.size() > current->size() * 0.95 ) break;
+        levels.push_back(std::move(coarse));
+        cmaps.push_back(std::move(cmap));
+        current = &levels.back();
+    }
+    partOutput->verbose(CALL_INFO, 1, 0, "- Coarsening levels:                %10zu\n", levels.size());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Coarsest graph vertices:          %10zu\n", current->size());
+
+    std::vector<uint32_t> part = initialPartition(*current, nparts);
+    refine(*current, nparts, part, max_pwgt, num_threads);
+
+    // Project the partition back through each level, refining as we go
+    for ( size_t level = levels.size(); level-- > 0; ) {
+        const Graph&          fine = level == 0 ? graph : levels[level - 1];
+        std::vector<uint32_t> fine_part(fine.size());
+        for ( size_t v = 0; v < fine.size(); ++v )
+            fine_part[v] = part[cmaps[level][v]];
+        part.swap(fine_part);
+        refine(fine, nparts, part, max_pwgt, num_threads);
+    }
+    return part;
+}
+
+void
+SSTMultilevelPartition::assignRanks(
+    const std::vector<PartitionComponent*>& vertices, const std::vector<uint32_t>& parts)
+{
+    for ( size_t i = 0; i < vertices.size(); ++i )
+        vertices[i]->rank = RankInfo(parts[i] / rankcount.thread, parts[i] % rankcount.thread);
+}
+
+double
+SSTMultilevelPartition::componentWeight(const PartitionComponent* comp)
+{
+    return comp->weight;
+}
+
+double
+SSTMultilevelPartition::linkWeight(const PartitionLink& link)
+{
+    return 1.0 / std::max<SimTime_t>(link.getMinLatency(), 1);
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* graph)
+{
+    uint32_t nparts = rankcount.rank * rankcount.thread;
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", graph->getNumComponents());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Partitions:                       %10" PRIu32 "\n", nparts);
+
+    std::vector<PartitionComponent*> vertices;
+    Graph                            g     = buildGraph(graph, vertices);
+    std::vector<uint32_t>            parts = partitionGraph(g, nparts);
+    assignRanks(vertices, parts);
+
+    // Report the quality of the partition
+    size_t              cut_links = 0;
+    std::vector<double> pwgt(nparts, 0.0);
+    for ( size_t v = 0; v < g.size(); ++v ) {
+        pwgt[parts[v]] += g.vwgt[v];
+        for ( size_t j = g.xadj[v]; j < g.xadj[v + 1]; ++j )
+            if ( parts[g.adjncy[j]] != parts[v] ) ++cut_links;
+    }
+    double avg = totalWeight(g) / nparts;
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut edges:                        %10zu\n", cut_links / 2);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Max part weight / average:        %10.3f\n",
+        avg > 0.0 ? *std::max_element(pwgt.begin(), pwgt.end()) / avg : 0.0);
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
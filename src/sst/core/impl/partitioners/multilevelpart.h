@@ -0,0 +1,146 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sstpart.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST {
+class Output;
+class PartitionComponent;
+class PartitionLink;
+} // namespace SST
+
+namespace SST::IMPL::Partition {
+
+/**
+   Multilevel k-way partitioner in the style of METIS.  The graph is
+   repeatedly coarsened by collapsing heavy edge matchings, the
+   coarsest graph is partitioned by growing regions, and the partition
+   is then projected back through each level and refined by moving
+   boundary vertices.
+
+   Vertex weights are the component weights and edge weights are the
+   inverse of the link latency, so the partitioner prefers to cut the
+   links with the most lookahead.  Move gains during refinement are
+   computed in parallel across threads; the moves are then applied
+   serially so that the balance constraint is always honored.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that coarsens the graph using heavy edge matching, partitions the coarsest graph and "
+        "refines the partition on the way back up.  Links with low latency are the most expensive to cut.")
+
+    /**
+       Graph in compressed sparse row format.  The neighbors of vertex
+       v are adjncy[xadj[v]] through adjncy[xadj[v+1]-1].  adjlat holds
+       the lowest latency of the links that make up each edge; it is
+       only filled in by buildGraph().
+     */
+    struct Graph
+    {
+        std::vector<size_t>    xadj;
+        std::vector<uint32_t>  adjncy;
+        std::vector<double>    adjwgt;
+        std::vector<SimTime_t> adjlat;
+        std::vector<double>    vwgt;
+
+        size_t size() const { return vwgt.size(); }
+    };
+
+    /**
+       Contract graph into a graph with cn vertices, where vertex v of
+       graph becomes vertex cmap[v].  Vertex and edge weights are
+       summed and edges inside a contracted vertex are dropped.
+     */
+    static Graph contractGraph(const Graph& graph, const std::vector<uint32_t>& cmap, size_t cn);
+
+    /**
+       Heaviest a part is allowed to be when partitioning graph into
+       nparts parts
+     */
+    static double maxPartWeight(const Graph& graph, uint32_t nparts);
+
+protected:
+    /** Number of ranks in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+    /** Number of threads to use while refining */
+    int      num_threads;
+
+    /**
+       Build the graph to partition from a PartitionGraph.  Vertex i
+       of the result is vertices[i].  Links between the same pair of
+       vertices are combined into one edge.
+     */
+    Graph buildGraph(PartitionGraph* graph, std::vector<PartitionComponent*>& vertices);
+
+    /** Weight of the vertex for comp.  Defaults to the component weight. */
+    virtual double componentWeight(const PartitionComponent* comp);
+
+    /**
+       Weight of the edge for link.  Defaults to the inverse of the link
+       latency.
+     */
+    virtual double linkWeight(const PartitionLink& link);
+
+    /**
+       Partition graph into nparts parts, returning the part of each
+       vertex.  No part will be made heavier than max_pwgt by a
+       refinement move; if it is zero, maxPartWeight(graph, nparts) is
+       used.
+     */
+    std::vector<uint32_t> partitionGraph(const Graph& graph, uint32_t nparts, double max_pwgt = 0.0);
+
+    /** Write the parts onto the components */
+    void assignRanks(const std::vector<PartitionComponent*>& vertices, const std::vector<uint32_t>& parts);
+
+    /** Constructor for subclasses, which use their own output prefix */
+    SSTMultilevelPartition(RankInfo rankCount, int verbosity, const std::string& prefix);
+
+public:
+    /**
+       Creates a new multilevel partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
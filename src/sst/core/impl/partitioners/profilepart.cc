@@ -0,0 +1,154 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/profilepart.h"
+
+#include "sst/core/config.h"
+#include "sst/core/model/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+using namespace SST::IMPL::Partition;
+
+SSTProfilePartition::SSTProfilePartition(RankInfo rankCount, RankInfo UNUSED(my_rank), int verbosity) :
+    SSTMultilevelPartition(rankCount, verbosity, "ProfilePartition ")
+{}
+
+bool
+SSTProfilePartition::readProfile(const std::string& filename, std::map<port_key_t, uint64_t>& port_events)
+{
+    std::ifstream in(filename);
+    if ( !in.is_open() ) return false;
+
+    std::string line;
+    while ( std::getline(in, line) ) {
+        if ( line.empty() || line[0] == '#' ) continue;
+
+        std::istringstream fields(line);
+        std::string        kind;
+        ComponentId_t      id;
+        uint64_t           value;
+        std::string        name;
+        fields >> kind >> id >> value;
+        if ( fields.fail() ) {
+            partOutput->fatal(
+                CALL_INFO, 1, "ERROR: malformed line in partition profile %s: %s\n", filename.c_str(), line.c_str());
+        }
+        std::getline(fields >> std::ws, name);
+
+        if ( kind == "component" )
+            comp_time_[COMPONENT_ID_MASK(id)] += value;
+        else if ( kind == "port" )
+            port_events[port_key_t(id, name)] += value;
+        else
+            partOutput->fatal(CALL_INFO, 1, "ERROR: unknown record type in partition profile %s: %s\n",
+                filename.c_str(), kind.c_str());
+    }
+    return true;
+}
+
+void
+SSTProfilePartition::performPartition(ConfigGraph* graph)
+{
+    // Only rank 0 has the graph to partition
+    if ( graph->getNumComponents() == 0 ) return;
+
+    const std::string& filename = Simulation::config.partitioner_profile();
+    if ( filename.empty() ) {
+        partOutput->fatal(CALL_INFO, 1, "ERROR: the sst.profile partitioner requires --partitioner-profile\n");
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Reading partition profile %s\n", filename.c_str());
+
+    // A multi-rank profile is split into one file per rank
+    std::map<port_key_t, uint64_t> port_events;
+    int                            files = 0;
+    if ( readProfile(filename, port_events) ) {
+        files = 1;
+    }
+    else {
+        while ( readProfile(filename + "." + std::to_string(files), port_events) )
+            files++;
+    }
+    if ( files == 0 ) {
+        partOutput->fatal(CALL_INFO, 1, "ERROR: unable to open partition profile %s\n", filename.c_str());
+    }
+
+    // Events are profiled where they are received, so each end of a
+    // link adds its count.  Handlers registered by anonymous
+    // subcomponents use their own id, so fall back to matching on the
+    // top level component when the port name is unambiguous.
+    std::map<port_key_t, LinkId_t> exact;
+    std::map<port_key_t, LinkId_t> top_level;
+    std::map<port_key_t, bool>     ambiguous;
+    for ( ConfigLink* link : graph->getLinkMap() ) {
+        for ( int i = 0; i < 2; ++i ) {
+            exact[port_key_t(link->component_[i], link->port_[i])] = link->id_;
+            port_key_t key(COMPONENT_ID_MASK(link->component_[i]), link->port_[i]);
+            if ( !top_level.emplace(key, link->id_).second ) ambiguous[key] = true;
+        }
+    }
+
+    size_t matched = 0;
+    for ( auto& x : port_events ) {
+        auto link = exact.find(x.first);
+        if ( link == exact.end() ) {
+            port_key_t key(COMPONENT_ID_MASK(x.first.first), x.first.second);
+            if ( ambiguous.count(key) ) continue;
+            link = top_level.find(key);
+            if ( link == top_level.end() ) continue;
+        }
+        link_events_[link->second] += x.second;
+        matched++;
+    }
+
+    // Unprofiled components are treated as average ones
+    double total = 0.0;
+    for ( auto& x : comp_time_ )
+        total += x.second;
+    if ( total > 0.0 ) default_time_ = total / comp_time_.size();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Profile files read:               %10d\n", files);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Profiled components:              %10zu\n", comp_time_.size());
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Profiled ports matched:           %10zu of %zu\n", matched, port_events.size());
+
+    PartitionGraph* pgraph = graph->getCollapsedPartitionGraph();
+    SSTMultilevelPartition::performPartition(pgraph);
+    graph->annotateRanks(pgraph);
+    delete pgraph;
+}
+
+double
+SSTProfilePartition::componentWeight(const PartitionComponent* comp)
+{
+    double weight = 0.0;
+    for ( ComponentId_t id : comp->group ) {
+        auto time = comp_time_.find(id);
+        weight += time == comp_time_.end() ? default_time_ : time->second;
+    }
+    return weight;
+}
+
+double
+SSTProfilePartition::linkWeight(const PartitionLink& link)
+{
+    // Links that were never used still cost something to cut
+    auto     events = link_events_.find(link.id_);
+    uint64_t count  = events == link_events_.end() ? 0 : events->second;
+    return (1.0 + count) / std::max<SimTime_t>(link.getMinLatency(), 1);
+}
@@ -0,0 +1,87 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_PROFILEPART_H
+#define SST_CORE_IMPL_PARTITONERS_PROFILEPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace SST::IMPL::Partition {
+
+/**
+   Profile guided version of the multilevel partitioner.  The profile
+   is written by a previous run of the model with the
+   profile.handler.event.partition profile tool and passed in with
+   --partitioner-profile.  Components are weighted by the time spent
+   in their event handlers and links by the number of events that
+   crossed them divided by their latency.  Components that don't
+   appear in the profile get the average measured weight.
+*/
+class SSTProfilePartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTProfilePartition,
+        "sst",
+        "profile",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that weights components by their measured handler time and links by their measured "
+        "event counts.  The profile is given with --partitioner-profile and is written by the "
+        "profile.handler.event.partition profile tool.")
+
+    /**
+       Creates a new profile guided partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTProfilePartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(ConfigGraph* graph) override;
+    using SSTMultilevelPartition::performPartition;
+
+    bool requiresConfigGraph() override { return true; }
+
+protected:
+    double componentWeight(const PartitionComponent* comp) override;
+    double linkWeight(const PartitionLink& link) override;
+
+private:
+    using port_key_t = std::pair<ComponentId_t, std::string>;
+
+    /**
+       Read one profile file, adding its data to comp_time_ and
+       port_events.  Returns false if the file can't be opened.
+     */
+    bool readProfile(const std::string& filename, std::map<port_key_t, uint64_t>& port_events);
+
+    /** Handler time in ns of each profiled top level component */
+    std::unordered_map<ComponentId_t, double> comp_time_;
+    /** Number of events that crossed each profiled link */
+    std::unordered_map<LinkId_t, uint64_t>    link_events_;
+    /** Weight used for components that weren't profiled */
+    double                                    default_time_ = 1.0;
+};
+
+} // namespace SST::IMPL::Partition
+
+#endif // SST_CORE_IMPL_PARTITONERS_PROFILEPART_H
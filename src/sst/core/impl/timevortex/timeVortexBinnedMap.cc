@@ -17,6 +17,7 @@
 #include "sst/core/output.h"
 
 #include <algorithm>
+#include <mutex>
 
 namespace SST::IMPL {
 
@@ -24,11 +25,15 @@ namespace SST::IMPL {
 // (faster delete)
 static Activity::greater<true, true, true> my_less;
 
-// Sort only happens in one thread
+// Sort can be triggered by other threads calling front() through
+// Simulation::getLocalMinimumNextActivityTime() during a thread sync,
+// so it needs the lock even when the TimeVortex is not thread safe
 template <bool TS>
 void
 TimeVortexBinnedMapBase<TS>::TimeUnit::sort()
 {
+    std::lock_guard<SST::Core::ThreadSafe::Spinlock> lock(tu_lock);
+    if ( sorted ) return;
     // Need to sort array in preparation for running through the
     // activities
     std::sort(activities.begin(), activities.end(), my_less);
@@ -47,10 +52,20 @@ TimeVortexBinnedMapBase<TS>::TimeVortexBinnedMapBase(Params& UNUSED(params)) :
     // Initialize things with with time = 0 TimeUnit
     auto entry = pool.remove();
     entry->setSortTime(0);
-    // map.emplace_hint(map.end(), 0, entry);
     current_time_unit = entry;
 }
 
+template <bool TS>
+TimeVortexBinnedMapBase<TS>::~TimeVortexBinnedMapBase()
+{
+    // Activities in TimeVortex all need to be deleted.  The TimeUnits
+    // delete their activities, and the ones in the pool are empty.
+    delete current_time_unit;
+    for ( auto* unit : bins ) {
+        delete unit;
+    }
+}
+
 template <bool TS>
 bool
 TimeVortexBinnedMapBase<TS>::empty()
@@ -94,15 +109,17 @@ TimeVortexBinnedMapBase<TS>::insert(Activity* activity)
     }
 
     // Look to see if we already have a TimeUnit for this delivery
-    // time.  Any access to the map must be protected with a mutex.
+    // time.  Any access to the bins must be protected with a mutex.
     if constexpr ( TS ) slock.lock();
-    auto element = map.find(sort_time);
-    if ( element == map.end() ) {
-        // Need to create a new entry in map for this delivery time,
-        // put in this activity.
-        auto entry = pool.remove();
+    TimeUnit* entry = index.find(sort_time);
+    if ( entry == nullptr ) {
+        // Need to create a new bin for this delivery time, put in
+        // this activity.
+        entry = pool.remove();
         entry->setSortTime(sort_time);
-        map.emplace_hint(map.end(), sort_time, entry);
+        index.insert(entry);
+        bins.push_back(entry);
+        std::push_heap(bins.begin(), bins.end(), typename TimeUnit::pq_less());
         if constexpr ( TS ) slock.unlock();
         entry->insert(activity);
     }
@@ -111,7 +128,7 @@ TimeVortexBinnedMapBase<TS>::insert(Activity* activity)
         // inserting.
         if constexpr ( TS ) slock.unlock();
         // Just drop this into the existing vector
-        (*element).second->insert(activity);
+        entry->insert(activity);
     }
 }
 
@@ -129,10 +146,11 @@ TimeVortexBinnedMapBase<TS>::pop()
 
         // Return current time unit to pool
         pool.insert(current_time_unit);
-        // Get next time unit
-        current_time_unit = map.begin()->second;
-        // Erase this time unit from map
-        map.erase(current_time_unit->getSortTime());
+        // Get next time unit and remove it from the bins
+        std::pop_heap(bins.begin(), bins.end(), typename TimeUnit::pq_less());
+        current_time_unit = bins.back();
+        bins.pop_back();
+        index.erase(current_time_unit->getSortTime());
         if constexpr ( TS ) slock.unlock();
         ret = current_time_unit->pop();
     }
@@ -146,9 +164,8 @@ TimeVortexBinnedMapBase<TS>::front()
     // if ( TS ) slock.lock();
     Activity* ret = current_time_unit->front();
     // Check to see if we need to look at the next timeunit
-    if ( ret == nullptr ) {
-        auto it = map.begin();
-        ret     = it->second->front();
+    if ( ret == nullptr && !bins.empty() ) {
+        ret = bins.front()->front();
     }
     // if ( TS ) slock.unlock();
     return ret;
@@ -156,11 +173,14 @@ TimeVortexBinnedMapBase<TS>::front()
 
 template <bool TS>
 void
-TimeVortexBinnedMapBase<TS>::print(Output& out) const
+TimeVortexBinnedMapBase<TS>::getContents(std::vector<Activity*>& activities) const
 {
-    out.output("TimeVortex state:\n");
-
-    // Still need to figure out a reasonable way to print the state
+    activities.clear();
+    activities.reserve(current_depth);
+    current_time_unit->getContents(activities);
+    for ( auto* unit : bins ) {
+        unit->getContents(activities);
+    }
 }
 
 
@@ -173,7 +193,7 @@ public:
         "sst",
         "timevortex.map.binned",
         SST_ELI_ELEMENT_VERSION(1,0,0),
-        "[EXPERIMENTAL] TimeVortex based on std::map with events binned in time buckets.")
+        "[EXPERIMENTAL] TimeVortex with events binned in time buckets, kept in a heap with a flat hash index.")
 
 
     explicit TimeVortexBinnedMap(Params& params) :
@@ -191,7 +211,7 @@ public:
         "sst",
         "timevortex.map.binned.ts",
         SST_ELI_ELEMENT_VERSION(1,0,0),
-        "[EXPERIMENTAL] Thread-safe verion of TimeVortex based on std::map with events binned into time buckets."
+        "[EXPERIMENTAL] Thread-safe verion of TimeVortex with events binned into time buckets."
         "  Do not reference this element directly; just specify sst.timevortex.map.binned and this version will"
         " be selected when it is needed based on other parameters.")
 
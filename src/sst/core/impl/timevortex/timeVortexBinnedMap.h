@@ -16,8 +16,6 @@
 
 #include <atomic>
 #include <cstdint>
-#include <map>
-#include <queue>
 #include <sst/core/timeVortex.h>
 #include <vector>
 
@@ -86,7 +84,7 @@ private:
             }
         }
 
-        inline SimTime_t getSortTime() { return sort_time; }
+        inline SimTime_t getSortTime() const { return sort_time; }
         inline void      setSortTime(SimTime_t time) { sort_time = time; }
 
 
@@ -109,7 +107,8 @@ private:
             return ret;
         }
 
-        // front only happens by one thread
+        // front can be called by other threads during a thread sync,
+        // sort() handles the locking
         Activity* front()
         {
             if ( 0 == activities.size() ) return nullptr;
@@ -119,6 +118,12 @@ private:
 
         void sort();
 
+        // Append the activities in this TimeUnit to activities
+        void getContents(std::vector<Activity*>& activities) const
+        {
+            activities.insert(activities.end(), this->activities.begin(), this->activities.end());
+        }
+
         inline bool operator<(const TimeUnit& rhs) { return this->sort_time < rhs.sort_time; }
 
         /** To use with STL priority queues, that order in reverse. */
@@ -136,10 +141,7 @@ private:
 
 public:
     explicit TimeVortexBinnedMapBase(Params& params);
-
-    // Activities in TimeVortex all need to be deleted, but that
-    // happens when the TimeUnit pool goes out of scope.
-    ~TimeVortexBinnedMapBase() = default;
+    ~TimeVortexBinnedMapBase();
 
     bool      empty() override;
     int       size() override;
@@ -147,26 +149,119 @@ public:
     Activity* pop() override;
     Activity* front() override;
 
-
-    /** Print the state of the TimeVortex */
-    void print(Output& out) const override;
-
     uint64_t getCurrentDepth() const override { return current_depth; }
     uint64_t getMaxDepth() const override { return max_depth; }
 
-    // TODO: Implement getContents(). For now, just return an empty
-    // vector.
-    void getContents(std::vector<Activity*>& UNUSED(activities)) const override {}
+    void getContents(std::vector<Activity*>& activities) const override;
 
 private:
+    /**
+       Flat hash index from delivery time to the TimeUnit holding the
+       activities for that time.  Uses open addressing with linear
+       probing in a single power of two sized array and keeps the
+       time next to the pointer, so lookups touch contiguous memory
+       rather than chasing tree nodes.  Deletes shift later entries
+       back so no tombstones are needed.
+     */
+    class BinIndex
+    {
+    public:
+        BinIndex() :
+            slots(initial_size),
+            mask(initial_size - 1),
+            count(0)
+        {}
+
+        TimeUnit* find(SimTime_t time) const
+        {
+            for ( size_t i = hash(time);; i = (i + 1) & mask ) {
+                const Slot& slot = slots[i];
+                if ( slot.unit == nullptr || slot.time == time ) return slot.unit;
+            }
+        }
+
+        // Unit's time must not already be in the index
+        void insert(TimeUnit* unit)
+        {
+            if ( (count + 1) * 2 > slots.size() ) grow();
+            place(unit->getSortTime(), unit);
+            count++;
+        }
+
+        // Time must be in the index
+        void erase(SimTime_t time)
+        {
+            size_t i = hash(time);
+            while ( slots[i].time != time || slots[i].unit == nullptr ) {
+                i = (i + 1) & mask;
+            }
+            // Move back any entries in the probe sequence after the
+            // hole that would otherwise no longer be reachable
+            size_t j = i;
+            while ( true ) {
+                j = (j + 1) & mask;
+                if ( slots[j].unit == nullptr ) break;
+                size_t home = hash(slots[j].time);
+                if ( ((j - home) & mask) >= ((j - i) & mask) ) {
+                    slots[i] = slots[j];
+                    i        = j;
+                }
+            }
+            slots[i].unit = nullptr;
+            count--;
+        }
+
+    private:
+        struct Slot
+        {
+            SimTime_t time = 0;
+            TimeUnit* unit = nullptr;
+        };
+
+        static constexpr size_t initial_size = 64;
+
+        inline size_t hash(SimTime_t time) const
+        {
+            // Fibonacci hashing spreads the (often evenly spaced)
+            // delivery times across the table
+            return static_cast<size_t>((time * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        }
+
+        void place(SimTime_t time, TimeUnit* unit)
+        {
+            size_t i = hash(time);
+            while ( slots[i].unit != nullptr ) {
+                i = (i + 1) & mask;
+            }
+            slots[i].time = time;
+            slots[i].unit = unit;
+        }
+
+        void grow()
+        {
+            std::vector<Slot> old(slots.size() * 2);
+            old.swap(slots);
+            mask = slots.size() - 1;
+            for ( auto& slot : old ) {
+                if ( slot.unit != nullptr ) place(slot.time, slot.unit);
+            }
+        }
+
+        std::vector<Slot> slots;
+        size_t            mask;
+        size_t            count;
+    };
+
     // Should only ever be accessed by the "active" thread.  Not safe
     // for concurrent access.
     TimeUnit* current_time_unit;
 
-    using mapType_t = std::map<SimTime_t, TimeUnit*>;
-
-    // Accessed by multiple threads, must be locked when accessing
-    mapType_t                                               map;
+    // Accessed by multiple threads, must be locked when accessing.
+    // TimeUnits for future delivery times are kept in a binary heap
+    // ordered by time, with the index used to find the TimeUnit for a
+    // given time.
+    std::vector<TimeUnit*>                                  bins;
+    BinIndex                                                index;
     std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> insertOrder;
     std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
 
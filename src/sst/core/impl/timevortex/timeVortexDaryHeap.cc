@@ -0,0 +1,213 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexDaryHeap.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <cstring>
+#include <new>
+
+namespace SST::IMPL {
+
+template <bool TS>
+TimeVortexDaryHeapBase<TS>::TimeVortexDaryHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    storage(nullptr),
+    capacity(0),
+    num_nodes(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+    grow();
+}
+
+template <bool TS>
+TimeVortexDaryHeapBase<TS>::~TimeVortexDaryHeapBase()
+{
+    // Activities in TimeVortexDaryHeap all need to be deleted
+    for ( size_t i = 0; i < num_nodes; ++i ) {
+        delete at(i).activity;
+    }
+    ::operator delete(storage, std::align_val_t(block_align));
+}
+
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::grow()
+{
+    size_t new_capacity = capacity == 0 ? 1024 : capacity * 2;
+    Node*  new_storage  = static_cast<Node*>(
+        ::operator new((new_capacity + root_offset) * sizeof(Node), std::align_val_t(block_align)));
+    if ( storage != nullptr ) {
+        std::memcpy(
+            static_cast<void*>(new_storage + root_offset), storage + root_offset, num_nodes * sizeof(Node));
+        ::operator delete(storage, std::align_val_t(block_align));
+    }
+    storage  = new_storage;
+    capacity = new_capacity;
+}
+
+template <bool TS>
+bool
+TimeVortexDaryHeapBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexDaryHeapBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::insert(Activity* activity)
+{
+    if constexpr ( TS ) slock.lock();
+    if ( UNLIKELY(num_nodes == capacity) ) grow();
+
+    Node node;
+    node.delivery_time = activity->getDeliveryTime();
+    node.priority_order =
+        (static_cast<uint64_t>(static_cast<uint32_t>(activity->getPriority())) << 32) | activity->getOrderTag();
+    node.queue_order = insertOrder;
+    node.activity    = activity;
+    activity->setQueueOrder(insertOrder++);
+
+    // Sift up
+    size_t index = num_nodes++;
+    while ( index > 0 ) {
+        size_t parent = (index - 1) / arity;
+        if ( !(node < at(parent)) ) break;
+        at(index) = at(parent);
+        index     = parent;
+    }
+    at(index) = node;
+
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+    if constexpr ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDaryHeapBase<TS>::pop()
+{
+    if constexpr ( TS ) slock.lock();
+    if ( num_nodes == 0 ) {
+        if constexpr ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret  = at(0).activity;
+    Node      last = at(--num_nodes);
+
+    // Sift down, moving the hole at the root toward the leaves until
+    // last fits
+    size_t index = 0;
+    while ( true ) {
+        size_t first = index * arity + 1;
+        if ( first >= num_nodes ) break;
+        size_t end      = first + arity < num_nodes ? first + arity : num_nodes;
+        size_t smallest = first;
+        for ( size_t child = first + 1; child < end; ++child ) {
+            if ( at(child) < at(smallest) ) smallest = child;
+        }
+        if ( !(at(smallest) < last) ) break;
+
+        // Fetch the next group of children while this level is moved
+        size_t next = smallest * arity + 1;
+        if ( next < num_nodes ) __builtin_prefetch(&at(next));
+
+        at(index) = at(smallest);
+        index     = smallest;
+    }
+    at(index) = last;
+
+    current_depth--;
+    if constexpr ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexDaryHeapBase<TS>::front()
+{
+    if constexpr ( TS ) slock.lock();
+    Activity* ret = num_nodes == 0 ? nullptr : at(0).activity;
+    if constexpr ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDaryHeapBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    activities.reserve(num_nodes);
+    for ( size_t i = 0; i < num_nodes; ++i ) {
+        activities.push_back(storage[i + root_offset].activity);
+    }
+}
+
+
+class TimeVortexDaryHeap : public TimeVortexDaryHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDaryHeap,
+        "sst",
+        "timevortex.dary_heap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on a cache-aligned 4-ary heap with the sort keys stored in the heap nodes.")
+
+
+    explicit TimeVortexDaryHeap(Params& params) :
+        TimeVortexDaryHeapBase<false>(params)
+    {}
+    TimeVortexDaryHeap()  = delete;
+    ~TimeVortexDaryHeap() = default;
+
+    SST_ELI_EXPORT(TimeVortexDaryHeap)
+};
+
+class TimeVortexDaryHeap_ts : public TimeVortexDaryHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDaryHeap_ts,
+        "sst",
+        "timevortex.dary_heap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread-safe verion of TimeVortex based on a 4-ary heap.  Do not reference this element"
+        " directly; just specify sst.timevortex.dary_heap and this version will be selected when it is needed based"
+        " on other parameters.")
+
+    explicit TimeVortexDaryHeap_ts(Params& params) :
+        TimeVortexDaryHeapBase<true>(params)
+    {}
+    TimeVortexDaryHeap_ts()  = delete;
+    ~TimeVortexDaryHeap_ts() = default;
+
+    SST_ELI_EXPORT(TimeVortexDaryHeap_ts)
+};
+
+} // namespace SST::IMPL
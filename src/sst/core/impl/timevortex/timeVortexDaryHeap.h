@@ -0,0 +1,105 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
+
+#include "sst/core/activity.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * TimeVortex based on a 4-ary min-heap whose nodes carry their sort
+ * key inline.
+ *
+ * Each heap node holds the 128-bit (delivery time, priority/order
+ * tag) key and the queue order next to the Activity pointer, so
+ * comparisons during sift-up and sift-down never dereference the
+ * Activity.  Nodes are 32 bytes and the heap is laid out so that the
+ * four children of a node always share one 128 byte aligned block
+ * (two adjacent cache lines).
+ */
+template <bool TS>
+class TimeVortexDaryHeapBase : public TimeVortex
+{
+public:
+    explicit TimeVortexDaryHeapBase(Params& params);
+    TimeVortexDaryHeapBase() = delete;
+    ~TimeVortexDaryHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    struct alignas(32) Node
+    {
+        SimTime_t delivery_time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const Node& rhs) const
+        {
+            if ( delivery_time != rhs.delivery_time ) return delivery_time < rhs.delivery_time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    // Number of children per node
+    static constexpr size_t arity = 4;
+
+    // Alignment of the heap storage.  One group of children.
+    static constexpr size_t block_align = arity * sizeof(Node);
+
+    // Slot offset of the root.  Chosen so that the first child of
+    // every node lands on a block_align boundary.
+    static constexpr size_t root_offset = arity - 1;
+
+    inline Node& at(size_t index) { return storage[index + root_offset]; }
+
+    void grow();
+
+    Node*  storage;
+    size_t capacity;
+    size_t num_nodes;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDARYHEAP_H
@@ -0,0 +1,313 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadderQueue.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+
+#include <algorithm>
+
+namespace SST::IMPL {
+
+template <bool TS>
+TimeVortexLadderQueueBase<TS>::TimeVortexLadderQueueBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    top_start(0),
+    top_min(MAX_SIMTIME_T),
+    top_max(0),
+    num_rungs(0),
+    bottom_head(0),
+    insertOrder(0),
+    current_depth(0)
+{
+    max_depth = 0;
+    // Rungs are reused rather than freed, so allocate the maximum
+    // number up front
+    rungs.reserve(max_rungs);
+}
+
+template <bool TS>
+TimeVortexLadderQueueBase<TS>::~TimeVortexLadderQueueBase()
+{
+    // Activities in TimeVortexLadderQueue all need to be deleted
+    std::vector<Activity*> contents;
+    getContents(contents);
+    for ( auto* x : contents ) {
+        delete x;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderQueueBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexLadderQueueBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::insert(Activity* activity)
+{
+    if constexpr ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    current_depth++;
+    if ( current_depth > max_depth ) {
+        max_depth = current_depth;
+    }
+
+    SimTime_t time = activity->getDeliveryTime();
+
+    // Most inserts are for times beyond anything already in the
+    // ladder, so check top first
+    if ( time >= top_start ) {
+        top.push_back(activity);
+        if ( time < top_min ) top_min = time;
+        if ( time > top_max ) top_max = time;
+        if constexpr ( TS ) slock.unlock();
+        return;
+    }
+
+    // Look for the highest rung whose unconsumed buckets cover this
+    // time
+    for ( size_t i = 0; i < num_rungs; ++i ) {
+        Rung& rung = rungs[i];
+        if ( time >= rung.currentStart() ) {
+            rung.buckets[(time - rung.rung_start) / rung.bucket_width].push_back(activity);
+            rung.count++;
+            if constexpr ( TS ) slock.unlock();
+            return;
+        }
+    }
+
+    // Earlier than anything left in the rungs, so goes to the bottom
+    insertBottom(activity);
+    if constexpr ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderQueueBase<TS>::pop()
+{
+    if constexpr ( TS ) slock.lock();
+    if ( bottom_head == bottom.size() && !refillBottom() ) {
+        if constexpr ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret = bottom[bottom_head++];
+    current_depth--;
+    if constexpr ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderQueueBase<TS>::front()
+{
+    if constexpr ( TS ) slock.lock();
+    Activity* ret = nullptr;
+    if ( bottom_head != bottom.size() || refillBottom() ) {
+        ret = bottom[bottom_head];
+    }
+    if constexpr ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::getContents(std::vector<Activity*>& activities) const
+{
+    activities.clear();
+    activities.reserve(current_depth);
+    activities.insert(activities.end(), bottom.begin() + bottom_head, bottom.end());
+    for ( size_t i = 0; i < num_rungs; ++i ) {
+        const Rung& rung = rungs[i];
+        for ( size_t j = rung.current_bucket; j < rung.num_buckets; ++j ) {
+            activities.insert(activities.end(), rung.buckets[j].begin(), rung.buckets[j].end());
+        }
+    }
+    activities.insert(activities.end(), top.begin(), top.end());
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::spawnRung(std::vector<Activity*>& src, SimTime_t start, SimTime_t last)
+{
+    // Size the buckets so that, on average, each holds one activity.
+    // All arithmetic is done relative to start using the inclusive
+    // last time so that a range ending at MAX_SIMTIME_T can't
+    // overflow.
+    SimTime_t span  = last - start;
+    SimTime_t width = span / src.size() + 1;
+
+    if ( num_rungs == rungs.size() ) rungs.emplace_back();
+    Rung& rung          = rungs[num_rungs++];
+    rung.rung_start     = start;
+    rung.rung_last      = last;
+    rung.bucket_width   = width;
+    rung.num_buckets    = span / width + 1;
+    rung.current_bucket = 0;
+    rung.count          = src.size();
+    if ( rung.buckets.size() < rung.num_buckets ) rung.buckets.resize(rung.num_buckets);
+
+    for ( auto* act : src ) {
+        rung.buckets[(act->getDeliveryTime() - start) / width].push_back(act);
+    }
+    src.clear();
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::moveToBottom(std::vector<Activity*>& src)
+{
+    // Swap rather than copy so that the source keeps the (empty)
+    // storage from the old bottom for reuse
+    bottom.clear();
+    bottom.swap(src);
+    bottom_head = 0;
+    std::sort(bottom.begin(), bottom.end(), Activity::less<true, true, true>());
+}
+
+template <bool TS>
+void
+TimeVortexLadderQueueBase<TS>::insertBottom(Activity* activity)
+{
+    // New activities usually sort after everything in the bottom
+    // (same time, later queue order), so the insert is normally close
+    // to the end of the vector
+    auto it = std::upper_bound(
+        bottom.begin() + bottom_head, bottom.end(), activity, Activity::less<true, true, true>());
+    bottom.insert(it, activity);
+}
+
+template <bool TS>
+bool
+TimeVortexLadderQueueBase<TS>::refillBottom()
+{
+    while ( true ) {
+        if ( num_rungs == 0 ) {
+            if ( top.empty() ) return false;
+
+            // Anything later than what is currently in top will need
+            // to go into the new top.  If top_max is MAX_SIMTIME_T,
+            // later inserts at that same time will land in top, which
+            // is still correct for the end-of-simulation actions that
+            // use that time.
+            SimTime_t last = top_max;
+            SimTime_t min  = top_min;
+            top_start      = last == MAX_SIMTIME_T ? MAX_SIMTIME_T : last + 1;
+            top_min        = MAX_SIMTIME_T;
+            top_max        = 0;
+
+            if ( top.size() <= bucket_threshold || min == last ) {
+                moveToBottom(top);
+                return true;
+            }
+            spawnRung(top, min, last);
+        }
+
+        Rung& rung = rungs[num_rungs - 1];
+
+        // Find the next non-empty bucket
+        while ( rung.current_bucket < rung.num_buckets && rung.buckets[rung.current_bucket].empty() ) {
+            rung.current_bucket++;
+        }
+        if ( rung.current_bucket == rung.num_buckets ) {
+            // Rung is exhausted, move up the ladder
+            num_rungs--;
+            continue;
+        }
+
+        // Take the contents out of the bucket, since the rung may be
+        // popped and its storage reused for a new rung below
+        size_t index = rung.current_bucket++;
+        scratch.clear();
+        scratch.swap(rung.buckets[index]);
+        rung.count -= scratch.size();
+
+        // Last time that can still be inserted into this bucket's
+        // range
+        SimTime_t last = rung.current_bucket == rung.num_buckets ? rung.rung_last : rung.currentStart() - 1;
+        SimTime_t width = rung.bucket_width;
+
+        // Once the last bucket is taken, the rung is done.  Pop it
+        // now so that inserts never index past the end of it.
+        if ( rung.current_bucket == rung.num_buckets ) num_rungs--;
+
+        if ( scratch.size() > bucket_threshold && num_rungs < max_rungs && width > 1 ) {
+            auto [min_it, max_it] = std::minmax_element(scratch.begin(), scratch.end(),
+                [](const Activity* lhs, const Activity* rhs) { return lhs->getDeliveryTime() < rhs->getDeliveryTime(); });
+            SimTime_t min = (*min_it)->getDeliveryTime();
+            if ( min != (*max_it)->getDeliveryTime() ) {
+                spawnRung(scratch, min, last);
+                continue;
+            }
+        }
+
+        moveToBottom(scratch);
+        return true;
+    }
+}
+
+
+class TimeVortexLadderQueue : public TimeVortexLadderQueueBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadderQueue,
+        "sst",
+        "timevortex.ladder_queue",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on a ladder queue, with O(1) amortized insert and pop.")
+
+
+    explicit TimeVortexLadderQueue(Params& params) :
+        TimeVortexLadderQueueBase<false>(params)
+    {}
+    TimeVortexLadderQueue()  = delete;
+    ~TimeVortexLadderQueue() = default;
+
+    SST_ELI_EXPORT(TimeVortexLadderQueue)
+};
+
+class TimeVortexLadderQueue_ts : public TimeVortexLadderQueueBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadderQueue_ts,
+        "sst",
+        "timevortex.ladder_queue.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread-safe verion of TimeVortex based on a ladder queue.  Do not reference this element"
+        " directly; just specify sst.timevortex.ladder_queue and this version will be selected when it is needed"
+        " based on other parameters.")
+
+    explicit TimeVortexLadderQueue_ts(Params& params) :
+        TimeVortexLadderQueueBase<true>(params)
+    {}
+    TimeVortexLadderQueue_ts()  = delete;
+    ~TimeVortexLadderQueue_ts() = default;
+
+    SST_ELI_EXPORT(TimeVortexLadderQueue_ts)
+};
+
+} // namespace SST::IMPL
@@ -0,0 +1,140 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
+
+#include "sst/core/activity.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * TimeVortex based on a ladder queue (Tang, Goh and Thng).
+ *
+ * Activities are kept in three tiers:
+ *
+ *   - Top: an unsorted vector holding everything at or beyond
+ *     top_start.
+ *   - Rungs: arrays of unsorted buckets, each bucket covering a fixed
+ *     width of time.  Rungs are created from the top (or from an
+ *     overfull bucket of the rung above) only when needed.
+ *   - Bottom: a small sorted vector holding the activities that will
+ *     be delivered next.
+ *
+ * Only the bottom is ever sorted, and it is only filled from a single
+ * bucket at a time, so inserts and pops are O(1) amortized for the
+ * clustered delivery time distributions that are typical of SST
+ * simulations.  Ordering within the bottom uses the same (delivery
+ * time, priority/order tag, queue order) comparison as the other
+ * TimeVortex implementations.
+ */
+template <bool TS>
+class TimeVortexLadderQueueBase : public TimeVortex
+{
+public:
+    explicit TimeVortexLadderQueueBase(Params& params);
+    TimeVortexLadderQueueBase() = delete;
+    ~TimeVortexLadderQueueBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    Activity* pop() override;
+    Activity* front() override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+    void getContents(std::vector<Activity*>& activities) const override;
+
+private:
+    // Buckets holding more than this many activities are split into
+    // a new rung rather than being sorted into the bottom
+    static constexpr size_t bucket_threshold = 50;
+
+    // Maximum number of rungs in the ladder.  Once reached, buckets
+    // are sorted into the bottom regardless of their size
+    static constexpr size_t max_rungs = 8;
+
+    // One rung of the ladder.  Bucket i holds activities with delivery
+    // times in [rung_start + i * bucket_width, rung_start + (i+1) *
+    // bucket_width), up to and including rung_last.  Buckets before
+    // current_bucket have already been moved down the ladder.
+    struct Rung
+    {
+        SimTime_t                           rung_start;
+        SimTime_t                           rung_last;
+        SimTime_t                           bucket_width;
+        size_t                              num_buckets;
+        size_t                              current_bucket;
+        size_t                              count;
+        std::vector<std::vector<Activity*>> buckets;
+
+        SimTime_t currentStart() const { return rung_start + current_bucket * bucket_width; }
+    };
+
+    // Create a new rung below the current lowest rung that covers
+    // [start, last] and move the activities in src into it
+    void spawnRung(std::vector<Activity*>& src, SimTime_t start, SimTime_t last);
+
+    // Move the activities in src into the (empty) bottom and sort them
+    void moveToBottom(std::vector<Activity*>& src);
+
+    // Sorted insert into the bottom
+    void insertBottom(Activity* activity);
+
+    // Refill the bottom from the rungs and top.  Returns false if the
+    // queue is empty.
+    bool refillBottom();
+
+    // Top of the ladder
+    std::vector<Activity*> top;
+    SimTime_t              top_start;
+    SimTime_t              top_min;
+    SimTime_t              top_max;
+
+    // Rungs are reused once created, num_rungs is the number
+    // currently in use.  rungs[0] is the highest rung.
+    std::vector<Rung> rungs;
+    size_t            num_rungs;
+
+    // Holds the contents of a bucket while it is being moved down
+    // the ladder
+    std::vector<Activity*> scratch;
+
+    // Bottom of the ladder.  Sorted in ascending order starting at
+    // bottom_head; entries before bottom_head have already been popped.
+    std::vector<Activity*> bottom;
+    size_t                 bottom_head;
+
+    uint64_t insertOrder;
+
+    // Need current depth to be atomic if we are thread safe
+    std::conditional_t<TS, std::atomic<uint64_t>, uint64_t> current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDERQUEUE_H
@@ -15,6 +15,11 @@
 
 #include "sst/core/clock.h"
 #include "sst/core/output.h"
+#include "sst/core/simulation.h"
+
+#include <limits>
+#include <memory>
+#include <thread>
 
 namespace SST::IMPL {
 
@@ -94,6 +99,27 @@ TimeVortexPQBase<TS>::front()
     return ret;
 }
 
+template <bool TS>
+void
+TimeVortexPQBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if constexpr ( TS ) slock.lock();
+    Activity* first = data.top();
+    data.pop();
+    batch.push_back(first);
+
+    SimTime_t time     = first->getDeliveryTime();
+    int       priority = first->getPriority();
+    while ( !data.empty() ) {
+        Activity* next = data.top();
+        if ( next->getDeliveryTime() != time || next->getPriority() != priority ) break;
+        data.pop();
+        batch.push_back(next);
+    }
+    current_depth -= batch.size();
+    if constexpr ( TS ) slock.unlock();
+}
+
 template <bool TS>
 void
 TimeVortexPQBase<TS>::dbg_print(Output& out) const
@@ -157,4 +183,161 @@ public:
     SST_ELI_EXPORT(TimeVortexPQ_ts)
 };
 
+/**
+   Thread-safe TimeVortex for use with interthread links where
+   activities sent from other threads never take a lock.  Each
+   producer thread pushes into its own lock-free staging queue and the
+   owning thread drains all the staging queues into the underlying
+   priority queue before it looks at the front of the queue.
+   Activities inserted by the owning thread go directly into the
+   priority queue.
+ */
+class TimeVortexPQStaged_ts : public TimeVortexPQBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPQStaged_ts,
+        "sst",
+        "timevortex.priority_queue.staged.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] Thread-safe version of TimeVortex based on std::priority_queue where inserts from other"
+        " threads go through lock-free per-thread staging queues.  Do not reference this element directly; just"
+        " specify sst.timevortex.priority_queue.staged and this version will be selected when it is needed based on"
+        " other parameters.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "num_threads", "Number of threads in the simulation.  Set by the core.", "1" }
+    )
+
+    explicit TimeVortexPQStaged_ts(Params& params) :
+        TimeVortexPQBase<false>(params),
+        owner_(std::this_thread::get_id()),
+        pending_(0)
+    {
+        uint32_t num_threads = params.find<uint32_t>("num_threads", 1);
+        for ( uint32_t i = 0; i < num_threads; ++i ) {
+            staging_.emplace_back(new SST::Core::ThreadSafe::UnboundedSPSCQueue<Activity*>());
+        }
+    }
+    TimeVortexPQStaged_ts() = delete;
+
+    // Move anything still staged into the priority queue so it gets
+    // deleted with everything else
+    ~TimeVortexPQStaged_ts() { drain(); }
+
+    bool empty() override
+    {
+        drain();
+        return TimeVortexPQBase<false>::empty();
+    }
+
+    int size() override
+    {
+        drain();
+        return TimeVortexPQBase<false>::size();
+    }
+
+    void insert(Activity* activity) override
+    {
+        if ( std::this_thread::get_id() == owner_ ) {
+            TimeVortexPQBase<false>::insert(activity);
+            return;
+        }
+        staging_[getStagingIndex()]->insert(activity);
+        pending_.fetch_add(1, std::memory_order_release);
+    }
+
+    Activity* pop() override
+    {
+        drain();
+        return TimeVortexPQBase<false>::pop();
+    }
+
+    Activity* front() override
+    {
+        drain();
+        return TimeVortexPQBase<false>::front();
+    }
+
+    void popBatch(std::vector<Activity*>& batch) override
+    {
+        drain();
+        TimeVortexPQBase<false>::popBatch(batch);
+    }
+
+    void dbg_print(Output& out) const override
+    {
+        const_cast<TimeVortexPQStaged_ts*>(this)->drain();
+        TimeVortexPQBase<false>::dbg_print(out);
+    }
+
+    void getContents(std::vector<Activity*>& activities) const override
+    {
+        const_cast<TimeVortexPQStaged_ts*>(this)->drain();
+        TimeVortexPQBase<false>::getContents(activities);
+    }
+
+    SST_ELI_EXPORT(TimeVortexPQStaged_ts)
+
+private:
+    // Only called by the owning thread.  The exchange synchronizes
+    // with every producer whose increment it consumes, so all of
+    // their staged activities are visible.  Anything staged after the
+    // exchange leaves pending_ non-zero and is picked up on the next
+    // call.
+    void drain()
+    {
+        if ( pending_.load(std::memory_order_relaxed) == 0 ) return;
+        pending_.exchange(0, std::memory_order_acq_rel);
+        Activity* activity;
+        for ( auto& queue : staging_ ) {
+            while ( queue->try_remove(activity) ) {
+                TimeVortexPQBase<false>::insert(activity);
+            }
+        }
+    }
+
+    // Thread number of the calling thread.  Producers only insert
+    // once the run loop has started, so the Simulation object for the
+    // thread is always available by then.
+    static uint32_t getStagingIndex()
+    {
+        static thread_local uint32_t index = std::numeric_limits<uint32_t>::max();
+        if ( UNLIKELY(index == std::numeric_limits<uint32_t>::max()) ) {
+            index = Simulation::getSimulation()->getRank().thread;
+        }
+        return index;
+    }
+
+    std::thread::id owner_;
+
+    // One staging queue per thread, indexed by thread number
+    std::vector<std::unique_ptr<SST::Core::ThreadSafe::UnboundedSPSCQueue<Activity*>>> staging_;
+
+    CACHE_ALIGNED(std::atomic<uint64_t>, pending_);
+};
+
+class TimeVortexPQStaged : public TimeVortexPQBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexPQStaged,
+        "sst",
+        "timevortex.priority_queue.staged",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "[EXPERIMENTAL] TimeVortex based on std::priority_queue that uses lock-free staging queues for inserts from"
+        " other threads when interthread links are enabled.  When only one thread is inserting, this is identical"
+        " to sst.timevortex.priority_queue.")
+
+    explicit TimeVortexPQStaged(Params& params) :
+        TimeVortexPQBase<false>(params)
+    {}
+    TimeVortexPQStaged()  = delete;
+    ~TimeVortexPQStaged() = default;
+
+    SST_ELI_EXPORT(TimeVortexPQStaged)
+};
+
 } // namespace SST::IMPL
@@ -48,6 +48,7 @@ public:
     void      insert(Activity* activity) override;
     Activity* pop() override;
     Activity* front() override;
+    void      popBatch(std::vector<Activity*>& batch) override;
 
     uint64_t getCurrentDepth() const override { return current_depth; }
     uint64_t getMaxDepth() const override { return max_depth; }
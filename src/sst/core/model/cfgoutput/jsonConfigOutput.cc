@@ -441,11 +441,19 @@ JSONConfigGraphOutput::outputProgramOptions(const Config* cfg, std::ofstream& of
     record["heartbeat-wall-period"]  = std::to_string(cfg->heartbeat_wall_period());
     record["timebase"]               = cfg->timeBase();
     record["partitioner"]            = cfg->partitioner();
+    record["partitioner-profile"]    = cfg->partitioner_profile();
     record["timeVortex"]             = cfg->timeVortex();
     record["interthread-links"]      = cfg->interthread_links() ? "true" : "false";
+    record["batch-dispatch"]         = cfg->batch_dispatch() ? "true" : "false";
+    record["rank-sync-overlap"]      = cfg->rank_sync_overlap() ? "true" : "false";
+    record["rank-sync-pairwise"]     = cfg->rank_sync_pairwise() ? "true" : "false";
+    record["dissemination-barrier"]  = cfg->dissemination_barrier() ? "true" : "false";
     record["output-prefix-core"]     = cfg->output_core_prefix();
     record["checkpoint-sim-period"]  = cfg->checkpoint_sim_period();
     record["checkpoint-wall-period"] = std::to_string(cfg->checkpoint_wall_period());
+    record["checkpoint-async"]       = cfg->checkpoint_async() ? "true" : "false";
+    record["checkpoint-incremental"] = cfg->checkpoint_incremental() ? "true" : "false";
+    record["checkpoint-compress"]    = cfg->checkpoint_compress() ? "true" : "false";
 
     ofs << record.dump(2);
     ofs << ",\n";
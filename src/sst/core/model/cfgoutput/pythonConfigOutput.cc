@@ -392,15 +392,32 @@ PythonConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
         outputFile, "sst.setProgramOption(\"heartbeat-wall-period\", \"%" PRIu32 "\")\n", cfg->heartbeat_wall_period());
     fprintf(outputFile, "sst.setProgramOption(\"timebase\", \"%s\")\n", cfg->timeBase().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"partitioner\", \"%s\")\n", cfg->partitioner().c_str());
+    fprintf(
+        outputFile, "sst.setProgramOption(\"partitioner-profile\", \"%s\")\n", cfg->partitioner_profile().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"timeVortex\", \"%s\")\n", cfg->timeVortex().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"interthread-links\", \"%s\")\n",
         cfg->interthread_links() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"batch-dispatch\", \"%s\")\n", cfg->batch_dispatch() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"rank-sync-overlap\", \"%s\")\n",
+        cfg->rank_sync_overlap() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"rank-sync-pairwise\", \"%s\")\n",
+        cfg->rank_sync_pairwise() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"dissemination-barrier\", \"%s\")\n",
+        cfg->dissemination_barrier() ? "true" : "false");
     fprintf(outputFile, "sst.setProgramOption(\"output-prefix-core\", \"%s\")\n", cfg->output_core_prefix().c_str());
 
     fprintf(
         outputFile, "sst.setProgramOption(\"checkpoint-sim-period\", \"%s\")\n", cfg->checkpoint_sim_period().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"checkpoint-wall-period\", \"%" PRIu32 "\")\n",
         cfg->checkpoint_wall_period());
+    fprintf(
+        outputFile, "sst.setProgramOption(\"checkpoint-async\", \"%s\")\n", cfg->checkpoint_async() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"checkpoint-incremental\", \"%s\")\n",
+        cfg->checkpoint_incremental() ? "true" : "false");
+#ifdef HAVE_LIBZ
+    fprintf(outputFile, "sst.setProgramOption(\"checkpoint-compress\", \"%s\")\n",
+        cfg->checkpoint_compress() ? "true" : "false");
+#endif
 
     // Output the shared params
     fprintf(outputFile, "# Define the shared parameter sets:\n");
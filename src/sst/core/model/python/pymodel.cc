@@ -334,6 +334,8 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
     PyDict_SetItem(dict, SST_ConvertToPythonString("exit-after"), SST_ConvertToPythonLong(cfg->exit_after()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("partitioner"), SST_ConvertToPythonString(cfg->partitioner().c_str()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("partitioner-profile"),
+        SST_ConvertToPythonString(cfg->partitioner_profile().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("heartbeat-period"),
         SST_ConvertToPythonString(cfg->heartbeat_sim_period().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("heartbeat-sim-period"),
@@ -366,6 +368,14 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         dict, SST_ConvertToPythonString("time-vortex"), SST_ConvertToPythonString(cfg->timeVortex().c_str()));
     PyDict_SetItem(
         dict, SST_ConvertToPythonString("interthread-links"), SST_ConvertToPythonBool(cfg->interthread_links()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("batch-dispatch"), SST_ConvertToPythonBool(cfg->batch_dispatch()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("rank-sync-overlap"), SST_ConvertToPythonBool(cfg->rank_sync_overlap()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("rank-sync-pairwise"), SST_ConvertToPythonBool(cfg->rank_sync_pairwise()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("dissemination-barrier"),
+        SST_ConvertToPythonBool(cfg->dissemination_barrier()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("debug-file"), SST_ConvertToPythonString(cfg->debugFile().c_str()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("lib-path"), SST_ConvertToPythonString(cfg->libpath().c_str()));
     PyDict_SetItem(
@@ -395,6 +405,12 @@ getProgramOptions(PyObject* UNUSED(self), PyObject* UNUSED(args))
         SST_ConvertToPythonLong(cfg->checkpoint_wall_period()));
     PyDict_SetItem(dict, SST_ConvertToPythonString("checkpoint-prefix"),
         SST_ConvertToPythonString(cfg->checkpoint_prefix().c_str()));
+    PyDict_SetItem(
+        dict, SST_ConvertToPythonString("checkpoint-async"), SST_ConvertToPythonBool(cfg->checkpoint_async()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("checkpoint-incremental"),
+        SST_ConvertToPythonBool(cfg->checkpoint_incremental()));
+    PyDict_SetItem(dict, SST_ConvertToPythonString("checkpoint-compress"),
+        SST_ConvertToPythonBool(cfg->checkpoint_compress()));
 
     return dict;
 }
@@ -346,7 +346,9 @@ SSTCPTModelDefinition::createConfigGraph()
                 if ( pos != std::string::npos ) current_filename = line.substr(pos + 2);
             }
             else {
-                // parse "comp_id : offset (…)"
+                // parse "comp_id : offset (…)" or, for components
+                // that are stored in an earlier incremental
+                // checkpoint, "comp_id : offset @ filename (…)"
                 size_t c = line.find(':');
                 if ( c == std::string::npos ) continue;
 
@@ -357,10 +359,17 @@ SSTCPTModelDefinition::createConfigGraph()
                 auto paren = after.find(" (");
                 if ( paren != std::string::npos ) after = after.substr(0, paren);
 
+                std::string filename = current_filename;
+                auto        at       = after.find(" @ ");
+                if ( at != std::string::npos ) {
+                    filename = after.substr(at + 3);
+                    after    = after.substr(0, at);
+                }
+
                 ComponentId_t comp_id = from_string<ComponentId_t>(comp_str);
                 uint64_t      offset  = from_string<uint64_t>(after);
 
-                graph->annotateCompRestartLocation(comp_id, current_filename, offset);
+                graph->annotateCompRestartLocation(comp_id, filename, offset);
             }
         }
     }
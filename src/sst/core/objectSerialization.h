@@ -24,14 +24,9 @@ serialize(dataType& data)
 {
     SST::Core::Serialization::serializer ser;
 
-    ser.start_sizing();
-    SST_SER(data);
-
-    size_t size = ser.size();
-
-    std::vector<char> buffer(size);
+    std::vector<char> buffer;
 
-    ser.start_packing(buffer.data(), size);
+    ser.start_packing(buffer);
     SST_SER(data);
 
     return buffer;
@@ -15,12 +15,15 @@
 
 #include "sst/core/output.h"
 #include "sst/core/params.h"
+#include "sst/core/simulation.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/util/perfReporter.h"
 
 #include <chrono>
 #include <cinttypes>
 #include <cstdio>
+#include <fstream>
+#include <mutex>
 
 namespace SST::Profile {
 
@@ -155,6 +158,88 @@ EventHandlerProfileToolTime<T>::outputData(SST::Util::DataRecord* record, RankIn
 }
 
 
+namespace {
+// The partition profile tools on a rank (one per thread) merge their
+// data here.  The last one to output writes the file.
+struct partition_port_t
+{
+    std::string comp_name;
+    uint64_t    recv_time  = 0;
+    uint64_t    recv_count = 0;
+};
+
+std::mutex                                                        partition_mutex;
+int                                                               partition_tools = 0;
+std::map<std::pair<ComponentId_t, std::string>, partition_port_t> partition_data;
+} // namespace
+
+EventHandlerProfileToolPartition::EventHandlerProfileToolPartition(const std::string& name, Params& params) :
+    EventHandlerProfileTool(name, params)
+{
+    filename_ = params.find<std::string>("file", "partition_profile.txt");
+    std::lock_guard<std::mutex> lock(partition_mutex);
+    partition_tools++;
+}
+
+EventHandlerProfileToolPartition::~EventHandlerProfileToolPartition() {}
+
+uintptr_t
+EventHandlerProfileToolPartition::registerHandler(const AttachPointMetaData& mdata)
+{
+    const EventHandlerMetaData& data  = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    port_data_t&                entry = ports_[port_key_t(data.comp_id, data.port_name)];
+    entry.comp_name                   = data.comp_name;
+    return reinterpret_cast<uintptr_t>(&entry);
+}
+
+uintptr_t
+EventHandlerProfileToolPartition::registerLinkAttachTool(const AttachPointMetaData& mdata)
+{
+    // Only receives are recorded, but sends still need a valid key
+    return registerHandler(mdata);
+}
+
+void
+EventHandlerProfileToolPartition::outputData(SST::Util::DataRecord* record, RankInfo rank)
+{
+    std::lock_guard<std::mutex> lock(partition_mutex);
+    for ( auto& x : ports_ ) {
+        partition_port_t& entry = partition_data[x.first];
+        entry.comp_name         = x.second.comp_name;
+        entry.recv_time += x.second.recv_time;
+        entry.recv_count += x.second.recv_count;
+    }
+    record->addData("ports", (uint64_t)ports_.size());
+    if ( --partition_tools > 0 ) return;
+
+    std::string filename = filename_;
+    if ( Simulation::getSimulation()->getNumRanks().rank > 1 ) filename += "." + std::to_string(rank.rank);
+    std::ofstream out = Simulation::filesystem.ofstream(filename);
+    if ( !out.is_open() ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO_LONG, 1, "ERROR: unable to open partition profile file: %s\n", filename.c_str());
+    }
+
+    // Handler time is summed over the ports and subcomponents of each
+    // top level component
+    std::map<ComponentId_t, std::pair<std::string, uint64_t>> components;
+    for ( auto& x : partition_data ) {
+        auto& comp = components[COMPONENT_ID_MASK(x.first.first)];
+        comp.first = x.second.comp_name.substr(0, x.second.comp_name.find(':'));
+        comp.second += x.second.recv_time;
+    }
+
+    out << "# SST partition profile\n";
+    out << "# component <id> <handler time in ns> <name>\n";
+    out << "# port <component id> <events received> <port>\n";
+    for ( auto& x : components )
+        out << "component\t" << x.first << "\t" << x.second.second << "\t" << x.second.first << "\n";
+    for ( auto& x : partition_data )
+        out << "port\t" << x.first.first << "\t" << x.second.recv_count << "\t" << x.first.second << "\n";
+    partition_data.clear();
+}
+
+
 class EventHandlerProfileToolTimeHighResolution : public EventHandlerProfileToolTime<std::chrono::high_resolution_clock>
 {
 public:
@@ -24,6 +24,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <utility>
 
 namespace SST::Util {
 class DataRecord;
@@ -159,6 +160,68 @@ private:
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that records the time each component spends in its
+   event handlers and the number of events received on each of its
+   ports.  The data is written to a file that the sst.profile
+   partitioner reads to weight components and links.  All the threads
+   on a rank write to one file; when there is more than one rank, the
+   rank number is appended to the file name.
+ */
+class EventHandlerProfileToolPartition : public EventHandlerProfileTool
+{
+    struct port_data_t
+    {
+        std::string comp_name;
+        uint64_t    recv_time  = 0;
+        uint64_t    recv_count = 0;
+    };
+
+    using port_key_t = std::pair<ComponentId_t, std::string>;
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolPartition,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.partition",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that records handler time per component and events received per port to a file that can be "
+        "passed to the sst.profile partitioner using --partitioner-profile"
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "file", "File to write the profile to.  With more than one rank, the rank number is appended", "partition_profile.txt" },
+    )
+
+    EventHandlerProfileToolPartition(const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolPartition();
+
+    uintptr_t registerHandler(const AttachPointMetaData& mdata) override;
+    uintptr_t registerLinkAttachTool(const AttachPointMetaData& mdata) override;
+
+    void beforeHandler(uintptr_t UNUSED(key), const Event* UNUSED(event)) override
+    {
+        start_time_ = std::chrono::steady_clock::now();
+    }
+
+    void afterHandler(uintptr_t key) override
+    {
+        auto         total_time = std::chrono::steady_clock::now() - start_time_;
+        port_data_t* entry      = reinterpret_cast<port_data_t*>(key);
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->recv_count++;
+    }
+
+    void outputData(SST::Util::DataRecord* record, RankInfo rank) override;
+
+private:
+    std::string                           filename_;
+    std::chrono::steady_clock::time_point start_time_;
+    std::map<port_key_t, port_data_t>     ports_;
+};
+
 } // namespace SST::Profile
 
 #endif // SST_CORE_PROFILE_EVENTHANDLERPROFILETOOL_H
@@ -19,15 +19,17 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <vector>
 
 namespace SST::Core::Serialization::pvt {
 
 class ser_buffer_accessor
 {
-    char* const  bufstart_;
-    size_t const max_size_;
-    char*        bufptr_ = bufstart_;
-    size_t       size_   = 0;
+    char* const        bufstart_ = nullptr;
+    size_t const       max_size_ = 0;
+    char*              bufptr_   = bufstart_;
+    size_t             size_     = 0;
+    std::vector<char>* growable_ = nullptr;
 
 public:
     // constructor which is inherited by packer and unpacker
@@ -36,6 +38,12 @@ public:
         max_size_(size)
     {}
 
+    // constructor for packing by appending to a buffer that grows as
+    // needed, so no sizing pass is needed first
+    explicit ser_buffer_accessor(std::vector<char>& buffer) :
+        growable_(&buffer)
+    {}
+
     ser_buffer_accessor(const ser_buffer_accessor&)            = delete;
     ser_buffer_accessor& operator=(const ser_buffer_accessor&) = delete;
     ~ser_buffer_accessor()                                     = default;
@@ -43,6 +51,15 @@ public:
     // return a pointer to the buffer and then advance it size bytes
     void* buf_next(size_t size)
     {
+        if ( growable_ ) {
+            // The vector reallocates geometrically, so appending is
+            // amortized constant time.  The returned pointer is only
+            // good until the next call.
+            size_t offset = growable_->size();
+            growable_->resize(offset + size);
+            size_ += size;
+            return growable_->data() + offset;
+        }
         size_ += size;
         if ( size_ > max_size_ ) throw std::out_of_range("serialization buffer overrun");
         char* buf = bufptr_;
@@ -81,6 +81,14 @@ constexpr bool is_vector_bool_v = false;
 template <typename... Ts>
 constexpr bool is_vector_bool_v<std::vector<bool, Ts...>> = true;
 
+// Whether it is a std::vector whose elements are trivially serializable, so the elements can be copied as a single
+// block.  Each element is serialized as its raw bytes either way, so this doesn't change the serialized format.
+template <typename>
+constexpr bool is_trivial_vector_v = false;
+
+template <typename T, typename... Ts>
+constexpr bool is_trivial_vector_v<std::vector<T, Ts...>> = is_trivially_serializable_v<T> && !std::is_same_v<T, bool>;
+
 // Whether it is a simple map (not a multimap and has integral, floating-point, enum, or convertible to string keys)
 template <typename>
 constexpr bool is_simple_map_v = false;
@@ -155,7 +163,11 @@ class serialize_impl<OBJ, std::enable_if_t<is_insertable_v<OBJ>>>
             else
                 ser.size(size);
 
-            if constexpr ( is_vector_bool_v<OBJ> ) {
+            if constexpr ( is_trivial_vector_v<OBJ> ) {
+                // Copy the elements of a std::vector of trivially serializable elements all at once
+                ser.raw(obj.data(), size * sizeof(value_type));
+            }
+            else if constexpr ( is_vector_bool_v<OBJ> ) {
                 // For std::vector<bool>, iterate over bool values instead of references to elements.
                 for ( bool e : obj )
                     SST_SER(e); // as_ptr_elem not valid for bool
@@ -186,6 +198,14 @@ class serialize_impl<OBJ, std::enable_if_t<is_insertable_v<OBJ>>>
             size_t size {};
             ser.unpack(size);
 
+            // A std::vector of trivially serializable elements is copied straight out of the buffer in one block,
+            // which is usually mapped straight from a checkpoint file on restart
+            if constexpr ( is_trivial_vector_v<OBJ> ) {
+                obj.resize(size);
+                ser.raw(obj.data(), size * sizeof(value_type));
+                break;
+            }
+
             // Erase the container
             obj.clear();
 
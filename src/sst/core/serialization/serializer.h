@@ -29,6 +29,7 @@
 #include <cstring>
 #include <string>
 #include <variant>
+#include <vector>
 
 namespace SST::Core::Serialization {
 
@@ -59,6 +60,9 @@ public:
     // Starting a new mode destroys the tracking object of the current mode and constructs a new tracking object
     void start_sizing() { ser_.emplace<SIZER>(); }
     void start_packing(char* buffer, size_t size) { ser_.emplace<PACK>(buffer, size); }
+    // Pack by appending to buffer, growing it as needed, so the object only has to be traversed once. size() returns
+    // the number of bytes appended.
+    void start_packing(std::vector<char>& buffer) { ser_.emplace<PACK>(buffer); }
     void start_unpacking(char* buffer, size_t size) { ser_.emplace<UNPACK>(buffer, size); }
     void start_mapping(ObjectMap* obj) { ser_.emplace<MAP>(obj); }
 
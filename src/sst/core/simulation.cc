@@ -15,6 +15,7 @@
 // simulation header should stay here
 
 #include "sst/core/checkpointAction.h"
+#include "sst/core/checkpointBlob.h"
 #include "sst/core/clock.h"
 #include "sst/core/config.h"
 #include "sst/core/exit.h"
@@ -51,14 +52,17 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <exception>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <ostream>
 #include <set>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -194,6 +198,8 @@ Simulation::~Simulation()
 {
     // Clean up as best we can
 
+    if ( checkpoint_writer_.joinable() ) checkpoint_writer_.join();
+
     // If checkpoint_action is triggered on sim time then it will
     // be deleted when the timeVortex is deleted
     if ( checkpoint_action_->getNextCheckpointSimTime() == MAX_SIMTIME_T ) delete checkpoint_action_;
@@ -309,8 +315,12 @@ Simulation::Simulation(
         // Direct interthread links not yet supported with checkpointing
         direct_interthread = false;
     }
+    batch_dispatch_ = config.batch_dispatch();
 
+    // Thread-safe TimeVortex implementations may need to know how
+    // many threads can insert into them
     Params p;
+    p.insert("num_threads", std::to_string(num_ranks.thread));
 
     timeVortex = factory->Create<TimeVortex>(timeVortexType, p);
     if ( restart ) {
@@ -1096,6 +1106,7 @@ Simulation::run()
     // next event and only exit the run loop on the next iteration.
     // If there was a fault, a message will be printed.
     bool time_fault = false;
+    if ( batch_dispatch_ ) runBatched(time_fault);
     while ( LIKELY(!endSim && !time_fault) ) {
 
         current_activity     = timeVortex->pop();
@@ -1118,20 +1129,7 @@ Simulation::run()
         // in the main loop.  If one of the unlikely cases is hit, we
         // can differentiate then
         if ( UNLIKELY(0 != signal_arrived_ || enter_interactive_) ) {
-            if ( 0 != signal_arrived_ ) {
-                // Signal handling does not block signals
-                // which means the signal handler *could* run in parallel
-                // with the checking/clearing. Should be OK.
-                signal_arrived_ = 0;
-                real_time_->notifySignal();
-            }
-            // If serial execution (1 rank, 1 thread)
-            if ( (num_ranks.rank == 1) && (num_ranks.thread == 1) ) {
-                if ( enter_interactive_ ) {
-                    enter_interactive_ = false;
-                    if ( interactive_ != nullptr ) interactive_->execute(interactive_msg_);
-                }
-            } // Otherwise handled in sync manager
+            handleRunLoopSignals();
         }
 
 #if SST_PERIODIC_PRINT
@@ -1165,6 +1163,9 @@ Simulation::run()
 
     runBarrier.wait(); // TODO<- Is this needed?
 
+    // Don't leave a checkpoint half written
+    waitForCheckpointWrite();
+
     run_phase_total_time_ = sst_get_cpu_time() - run_phase_start_time_;
 
     // If we have no links that are cut by a partition, we need to do
@@ -1192,6 +1193,84 @@ Simulation::run()
     if ( num_ranks.rank != 1 && num_ranks.thread == 0 ) delete m_exit;
 }
 
+void
+Simulation::runBatched(bool& time_fault)
+{
+    // Same as the loop in run(), except that all the activities at
+    // the front of the TimeVortex with the same delivery time and
+    // priority are popped together and executed back to back.  The
+    // time fault and signal checks are done once per batch.
+    while ( LIKELY(!endSim && !time_fault) ) {
+        activity_batch_.clear();
+        // The core actions that run ahead of clocks (syncs,
+        // checkpoints, interactive console, etc) can look at or save
+        // the contents of the TimeVortex, so they are never batched
+        if ( UNLIKELY(timeVortex->front()->getPriority() < CLOCKPRIORITY) ) {
+            activity_batch_.push_back(timeVortex->pop());
+        }
+        else {
+            timeVortex->popBatch(activity_batch_);
+        }
+
+        // Every activity in the batch has the same time and priority
+        current_activity     = activity_batch_.front();
+        SimTime_t event_time = current_activity->getDeliveryTime();
+
+        time_fault = event_time < currentSimCycle;
+
+        currentSimCycle = event_time;
+
+        currentPriority = current_activity->getPriority();
+
+        size_t count = activity_batch_.size();
+        for ( size_t i = 0; i < count; ++i ) {
+            current_activity = activity_batch_[i];
+            current_activity->execute();
+
+            if ( UNLIKELY(endSim) ) {
+                // Put anything that didn't get executed back into the
+                // TimeVortex so it is handled the same as it would be
+                // without batching
+                for ( size_t j = i + 1; j < count; ++j ) {
+                    timeVortex->insert(activity_batch_[j]);
+                }
+                break;
+            }
+        }
+
+        if ( UNLIKELY(0 != signal_arrived_ || enter_interactive_) ) {
+            handleRunLoopSignals();
+        }
+
+#if SST_PERIODIC_PRINT
+        periodicCounter += count;
+        if ( periodicCounter >= SST_PERIODIC_PRINT_THRESHOLD ) {
+            periodicCounter = 0;
+            printPerformanceInfo();
+        }
+#endif
+    }
+}
+
+void
+Simulation::handleRunLoopSignals()
+{
+    if ( 0 != signal_arrived_ ) {
+        // Signal handling does not block signals
+        // which means the signal handler *could* run in parallel
+        // with the checking/clearing. Should be OK.
+        signal_arrived_ = 0;
+        real_time_->notifySignal();
+    }
+    // If serial execution (1 rank, 1 thread)
+    if ( (num_ranks.rank == 1) && (num_ranks.thread == 1) ) {
+        if ( enter_interactive_ ) {
+            enter_interactive_ = false;
+            if ( interactive_ != nullptr ) interactive_->execute(interactive_msg_);
+        }
+    } // Otherwise handled in sync manager
+}
+
 void
 Simulation::emergencyShutdown()
 {
@@ -1767,18 +1846,13 @@ Simulation::writeCheckpointConfigGraph(ConfigGraph* graph)
 
     SST::Core::Serialization::serializer ser;
 
-    size_t            size;
     std::vector<char> buffer;
 
     // We will serialize as a non-pointer so we can deserialize "in-place" on restart
-    ser.start_sizing();
+    ser.start_packing(buffer);
     SST_SER(*graph);
 
-    size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-    SST_SER(*graph);
+    size_t size = ser.size();
 
     std::ofstream fs =
         filesystem.ofstream(checkpoint_directory_ + "/" + checkpoint_configgraph_, std::ios::out | std::ios::binary);
@@ -1838,7 +1912,7 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
     std::vector<char> buffer;
 
     /* Section 1: Config options */
-    ser.start_sizing();
+    ser.start_packing(buffer);
 
     SST_SER(config);
 
@@ -1857,72 +1931,38 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
     SST_SER(os_);
 
     size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-
-    SST_SER(config);
-
-    SST_SER(num_ranks.rank);
-    SST_SER(num_ranks.thread);
-    SST_SER(currentSimCycle);
-    SST_SER(currentPriority);
-
-    // Add list of loaded libraries
-    SST_SER(libnames);
-
-    SST_SER(version_);
-    SST_SER(arch_);
-    SST_SER(os_);
-
     fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
     fs.write(buffer.data(), size);
 
 
     /* Section 1a: Shared regions */
-    ser.start_sizing();
+    buffer.clear();
+    ser.start_packing(buffer);
     SST_SER(SharedObject::manager);
 
     size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-    SST_SER(SharedObject::manager);
-
     fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
     fs.write(buffer.data(), size);
 
 
     /* Section 1b: stats config */
-    ser.start_sizing();
+    buffer.clear();
+    ser.start_packing(buffer);
     SST_SER(stats_config_);
 
     size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-    SST_SER(stats_config_);
-
     fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
     fs.write(buffer.data(), size);
 
     /* Section 2: Common data for Simulation */
-    ser.start_sizing();
+    buffer.clear();
+    ser.start_packing(buffer);
     SST_SER(num_ranks);
     SST_SER(minPart);
     SST_SER(minPartTC);
     SST_SER(max_event_id);
 
     size = ser.size();
-    buffer.resize(size);
-
-    ser.start_packing(buffer.data(), size);
-    SST_SER(num_ranks);
-    SST_SER(minPart);
-    SST_SER(minPartTC);
-    SST_SER(max_event_id);
-
-
     fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
     fs.write(buffer.data(), size);
 
@@ -1956,6 +1996,10 @@ Simulation::checkpoint_write_globals(int checkpoint_id, const std::string& check
 #undef WR
 
     fs_reg << "** (globals): " << globals_filename << std::endl;
+    if ( config.checkpoint_compress() ) {
+        fs_reg << "** (compression): " << Checkpointing::blobCompressionCodec() << ", "
+               << Checkpointing::blob_compression_block_size << " byte blocks" << std::endl;
+    }
     if ( !checkpoint_configgraph_.empty() ) fs_reg << "** (configgraph): ../" << checkpoint_configgraph_ << std::endl;
 
     fs_reg << "** (start component registry):" << std::endl;
@@ -1981,66 +2025,185 @@ Simulation::checkpoint_append_registry(const std::string& registry_name, const s
         std::string name = getComponent(x.first)->getName();
         fs << x.first << " : " << x.second << " (" << name << ")" << std::endl;
     }
+    // Components from an incremental checkpoint that are stored in an
+    // earlier checkpoint's blob file
+    for ( auto id : component_blob_reused_ ) {
+        std::string name = getComponent(id)->getName();
+        auto&       loc  = checkpoint_blob_locations_[id];
+        fs << id << " : " << loc.offset << " @ " << loc.filename << " (" << name << ")" << std::endl;
+    }
     fs.close();
 }
 
 void
 Simulation::checkpoint(const std::string& checkpoint_filename)
 {
+    // Only one checkpoint file is written in the background at a
+    // time, so make sure the last one is done before starting on this
+    // one
+    waitForCheckpointWrite();
+
     std::ofstream fs = filesystem.ofstream(checkpoint_filename, std::ios::out | std::ios::binary);
     // TODO: Add error checking for file open
 
     SST::Core::Serialization::serializer ser;
     ser.enable_pointer_tracking();
 
+    // Data is packed into an image that has the same layout as the
+    // file.  For async and compressed checkpoints, the whole partition
+    // goes into the image so it can be handed off to be compressed
+    // and/or written in the background.  Otherwise, the image is
+    // written out after each component.
+    const bool        async       = config.checkpoint_async();
+    const bool        compress    = config.checkpoint_compress();
+    const bool        whole_image = async || compress;
+    uint64_t          written     = 0;
+    std::vector<char> image;
+
+    // Sections are packed straight onto the end of the image, which
+    // grows as needed, so each object is only traversed once.  The
+    // section starts with a placeholder for its size, which is filled
+    // in once the data has been packed.
+    auto begin_section = [&image, &ser]() -> size_t {
+        size_t offset = image.size();
+        image.resize(offset + sizeof(size_t));
+        ser.start_packing(image);
+        return offset;
+    };
+    auto end_section = [&image, &ser](size_t offset) -> size_t {
+        size_t size = ser.size();
+        std::memcpy(&image[offset], &size, sizeof(size));
+        return size;
+    };
+
     /* Section 3: Simulation */
-    ser.start_sizing();
+    size_t offset = begin_section();
 
     SST_SER(interThreadMinLatency);
     SST_SER(independent);
 
+    end_section(offset);
+
     // First we need to get the TimeVortexContents and sort them
     tv_sort_.data.clear();
     timeVortex->getContents(tv_sort_.data);
     tv_sort_.sortData();
 
-    size_t            size = ser.size();
-    std::vector<char> buffer(size);
-
-    // Pack buffer
-    ser.start_packing(&buffer[0], size);
-
-    SST_SER(interThreadMinLatency);
-    SST_SER(independent);
-
-    // Write buffer to file
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-    fs.write(&buffer[0], size);
-
-    size = compInfoMap.size();
-    fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    // The component count is filled in below, since incremental
+    // checkpoints may not write every component
+    size_t count_offset = image.size();
+    size_t size         = compInfoMap.size();
+    image.insert(image.end(), reinterpret_cast<const char*>(&size), reinterpret_cast<const char*>(&size) + sizeof(size));
 
     // Clear the offsets vector to start this round
     component_blob_offsets_.clear();
+    component_blob_reused_.clear();
+
+    // Name of this blob file as seen from another checkpoint's
+    // directory
+    const bool        incremental = config.checkpoint_incremental();
+    const std::string blob_name =
+        "../" + std::filesystem::path(checkpoint_filename).lexically_relative(checkpoint_directory_).string();
 
     // Serialize component blobs individually
     for ( auto comp = compInfoMap.begin(); comp != compInfoMap.end(); comp++ ) {
-        ser.start_sizing();
         ComponentInfo* compinfo = *comp;
+        offset                  = begin_section();
         SST_SER(compinfo);
-        size = ser.size();
-        buffer.resize(size);
+        size = end_section(offset);
+
+        const char* data        = image.data() + offset + sizeof(size);
+        uint64_t    file_offset = written + offset;
+
+        if ( incremental ) {
+            // If the blob is the same as the last one written for this
+            // component, drop it and point to the earlier copy
+            // instead.  The earlier copy can't be used if this
+            // checkpoint is overwriting the file it is in.
+            size_t hash = std::hash<std::string_view>()(std::string_view(data, size));
+            auto   loc  = checkpoint_blob_locations_.find(compinfo->id_);
+            if ( loc != checkpoint_blob_locations_.end() && loc->second.hash == hash && loc->second.size == size &&
+                 loc->second.filename != blob_name ) {
+                image.resize(image.size() - sizeof(size) - size);
+                component_blob_reused_.push_back(compinfo->id_);
+                continue;
+            }
+            checkpoint_blob_locations_[compinfo->id_] = { hash, size, blob_name, file_offset };
+        }
 
-        ser.start_packing(&buffer[0], size);
-        SST_SER(compinfo);
+        component_blob_offsets_.emplace_back(compinfo->id_, file_offset);
 
-        component_blob_offsets_.emplace_back(compinfo->id_, fs.tellp());
-        fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
-        fs.write(&buffer[0], size);
+        if ( !whole_image ) {
+            fs.write(image.data(), image.size());
+            written += image.size();
+            image.clear();
+        }
     }
 
-    fs.close();
     tv_sort_.data.clear();
+
+    // The locations of the components that weren't written.  This is
+    // empty unless the checkpoint is incremental.
+    std::vector<std::pair<std::string, uint64_t>> references;
+    for ( auto id : component_blob_reused_ ) {
+        auto& loc = checkpoint_blob_locations_[id];
+        references.emplace_back(loc.filename, loc.offset);
+    }
+
+    offset = begin_section();
+    SST_SER(references);
+    end_section(offset);
+
+    size = component_blob_offsets_.size();
+    if ( !whole_image ) {
+        fs.write(image.data(), image.size());
+        if ( size != compInfoMap.size() ) {
+            fs.seekp(count_offset);
+            fs.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        }
+        fs.close();
+        return;
+    }
+    std::memcpy(&image[count_offset], &size, sizeof(size));
+
+    int compress_threads = checkpointCompressionThreads();
+    if ( !async ) {
+        image = Checkpointing::compressBlob(image, Checkpointing::blob_compression_block_size, compress_threads);
+        fs.write(image.data(), image.size());
+        fs.close();
+        return;
+    }
+
+    // The image doesn't reference any simulation state, so the run
+    // loop can continue while it is compressed and written out
+    checkpoint_writer_ = std::thread([this, fs = std::move(fs), image = std::move(image), compress,
+                                         compress_threads]() mutable {
+        if ( compress )
+            image = Checkpointing::compressBlob(image, Checkpointing::blob_compression_block_size, compress_threads);
+        fs.write(image.data(), image.size());
+        fs.close();
+        if ( fs.fail() ) checkpoint_write_failed_ = true;
+    });
+}
+
+int
+Simulation::checkpointCompressionThreads() const
+{
+    // Each thread gets its share of the cores, since all the threads
+    // checkpoint and restart at the same time
+    return std::max(1u, std::thread::hardware_concurrency() / num_ranks.thread);
+}
+
+void
+Simulation::waitForCheckpointWrite()
+{
+    if ( !checkpoint_writer_.joinable() ) return;
+
+    checkpoint_writer_.join();
+    if ( checkpoint_write_failed_ ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: Writing checkpoint file in the background failed (%u,%u)\n",
+            my_rank.rank, my_rank.thread);
+    }
 }
 
 void
@@ -2182,37 +2345,34 @@ Simulation::restart(ConfigGraph* graph)
 
         std::string current_filename;
 
-        std::ifstream     fs_blob;
-        std::vector<char> buffer;
-        size_t            size = 0;
+        // Each thread maps the files that hold its components, so
+        // only the pages for those components are read in
+        Checkpointing::BlobFile blob;
+        size_t                  size = 0;
         for ( auto& x : my_comps ) {
             if ( current_filename != x.first ) {
                 current_filename = x.first;
-                if ( fs_blob.is_open() ) fs_blob.close();
-                fs_blob.open(checkpoint_directory + "/" + current_filename, std::ios::binary);
+                restart_open_blob(blob, checkpoint_directory + "/" + current_filename);
             }
-            fs_blob.seekg(x.second);
-            fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-            buffer.resize(size);
-            fs_blob.read(buffer.data(), size);
-            ser.start_unpacking(buffer.data(), size);
+            uint64_t offset = x.second;
+            char*    data   = restart_blob_section(blob, offset, size, current_filename);
+            ser.start_unpacking(data, size);
             // ComponentInfo* compInfo = new ComponentInfo();
             ComponentInfo* compInfo;
             SST_SER(compInfo);
             compInfoMap.insert(compInfo);
         }
-        if ( fs_blob.is_open() ) fs_blob.close();
     }
     else if ( blob_filenames.size() == 1 ) {
         // This is a regular restart (same parallelism as checkpoint)
-        std::ifstream fs_blob(blob_filenames[0], std::ios::binary);
+        Checkpointing::BlobFile blob;
+        restart_open_blob(blob, blob_filenames[0]);
 
         /* Now get the global blob */
-        fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-        buffer.resize(size);
-        fs_blob.read(buffer.data(), size);
+        uint64_t offset = 0;
+        char*    data   = restart_blob_section(blob, offset, size, blob_filenames[0]);
 
-        ser.start_unpacking(buffer.data(), size);
+        ser.start_unpacking(data, size);
 
         SST_SER(interThreadMinLatency);
         SST_SER(independent);
@@ -2233,20 +2393,19 @@ Simulation::restart(ConfigGraph* graph)
 
 
         /* Extract components */
-        size_t compCount;
-        fs_blob.read(reinterpret_cast<char*>(&compCount), sizeof(compCount));
+        size_t compCount = restart_blob_count(blob, offset, blob_filenames[0]);
 
-        // Deserialize component blobs individually
+        // Deserialize component blobs individually, straight out of
+        // the file's mapping
         for ( size_t comp = 0; comp < compCount; comp++ ) {
-            fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-            buffer.resize(size);
-            fs_blob.read(&buffer[0], size);
-            ser.start_unpacking(&buffer[0], size);
+            data = restart_blob_section(blob, offset, size, blob_filenames[0]);
+            ser.start_unpacking(data, size);
             ComponentInfo* compInfo = new ComponentInfo();
             SST_SER(compInfo);
             compInfoMap.insert(compInfo);
+            blob.releaseBefore(offset);
         }
-        fs_blob.close();
+        restart_read_blob_references(blob, offset, blob_filenames[0], checkpoint_directory);
     }
     else {
         // This is a parallel checkpoint restarted as a serial job
@@ -2259,16 +2418,15 @@ Simulation::restart(ConfigGraph* graph)
         stat_engine.restart();
 
         // Now we need to extract the components from all of the files
-        std::ifstream fs_blob;
+        Checkpointing::BlobFile blob;
         for ( std::string filename : blob_filenames ) {
-            fs_blob.open(filename, std::ios::binary);
+            restart_open_blob(blob, filename);
 
             /* Now get the global blob */
-            fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-            buffer.resize(size);
-            fs_blob.read(buffer.data(), size);
+            uint64_t offset = 0;
+            char*    data   = restart_blob_section(blob, offset, size, filename);
 
-            ser.start_unpacking(buffer.data(), size);
+            ser.start_unpacking(data, size);
 
             // These are the variables interThreadLatencies and
             // independent. They aren't used in this path, but need to
@@ -2278,20 +2436,18 @@ Simulation::restart(ConfigGraph* graph)
             bool dummy_bool;
             SST_SER(dummy_bool); // independent
 
-            size_t compCount;
-            fs_blob.read(reinterpret_cast<char*>(&compCount), sizeof(compCount));
+            size_t compCount = restart_blob_count(blob, offset, filename);
 
             // Deserialize component blobs individually
             for ( size_t comp = 0; comp < compCount; comp++ ) {
-                fs_blob.read(reinterpret_cast<char*>(&size), sizeof(size));
-                buffer.resize(size);
-                fs_blob.read(&buffer[0], size);
-                ser.start_unpacking(&buffer[0], size);
+                data = restart_blob_section(blob, offset, size, filename);
+                ser.start_unpacking(data, size);
                 ComponentInfo* compInfo = new ComponentInfo();
                 SST_SER(compInfo);
                 compInfoMap.insert(compInfo);
+                blob.releaseBefore(offset);
             }
-            fs_blob.close();
+            restart_read_blob_references(blob, offset, filename, checkpoint_directory);
         }
     }
 
@@ -2321,6 +2477,70 @@ Simulation::restart(ConfigGraph* graph)
     // real_time_->begin();
 }
 
+void
+Simulation::restart_read_blob_references(const Checkpointing::BlobFile& blob, uint64_t offset,
+    const std::string& filename, const std::string& checkpoint_directory)
+{
+    size_t size;
+    char*  data = restart_blob_section(blob, offset, size, filename);
+
+    SST::Core::Serialization::serializer ser;
+    ser.enable_pointer_tracking();
+    ser.start_unpacking(data, size);
+
+    std::vector<std::pair<std::string, uint64_t>> references;
+    SST_SER(references);
+
+    // References are in component order, so components stored in the
+    // same earlier checkpoint are usually next to each other
+    std::string             current_filename;
+    Checkpointing::BlobFile ref_blob;
+    for ( auto& ref : references ) {
+        if ( current_filename != ref.first ) {
+            current_filename = ref.first;
+            restart_open_blob(ref_blob, checkpoint_directory + "/" + current_filename);
+        }
+        uint64_t ref_offset = ref.second;
+        data                = restart_blob_section(ref_blob, ref_offset, size, current_filename);
+        ser.start_unpacking(data, size);
+        ComponentInfo* compInfo;
+        SST_SER(compInfo);
+        compInfoMap.insert(compInfo);
+    }
+}
+
+void
+Simulation::restart_open_blob(Checkpointing::BlobFile& blob, const std::string& filename)
+{
+    if ( !blob.open(filename, checkpointCompressionThreads()) ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: Unable to open or decompress checkpoint file %s (%u,%u)\n",
+            filename.c_str(), my_rank.rank, my_rank.thread);
+    }
+}
+
+char*
+Simulation::restart_blob_section(
+    const Checkpointing::BlobFile& blob, uint64_t& offset, size_t& size, const std::string& filename)
+{
+    char* data = blob.section(offset, size);
+    if ( data == nullptr ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: Checkpoint file %s is truncated or corrupt (%u,%u)\n",
+            filename.c_str(), my_rank.rank, my_rank.thread);
+    }
+    return data;
+}
+
+size_t
+Simulation::restart_blob_count(const Checkpointing::BlobFile& blob, uint64_t& offset, const std::string& filename)
+{
+    size_t count = 0;
+    if ( !blob.read(offset, count) ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: Checkpoint file %s is truncated or corrupt (%u,%u)\n",
+            filename.c_str(), my_rank.rank, my_rank.thread);
+    }
+    return count;
+}
+
 void
 Simulation::checkIndependent()
 {
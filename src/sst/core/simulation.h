@@ -73,6 +73,10 @@ class TimeLord;
 class TimeVortex;
 class UnitAlgebra;
 
+namespace Checkpointing {
+class BlobFile;
+} // namespace Checkpointing
+
 namespace Statistics {
 class StatisticOutput;
 class StatisticProcessingEngine;
@@ -249,6 +253,12 @@ public:
 
     void run();
 
+    /** Run loop used for --batch-dispatch */
+    void runBatched(bool& time_fault);
+
+    /** Handle signals and interactive console requests seen by the run loop */
+    void handleRunLoopSignals();
+
     void finish();
 
     void updateSyncInterval();
@@ -409,6 +419,12 @@ public:
      */
     void checkpoint(const std::string& checkpoint_filename);
 
+    /**
+       Wait for a checkpoint file that is being written in the
+       background (see --checkpoint-async) to finish
+     */
+    void waitForCheckpointWrite();
+
     /**
        Append partitions registry information
      */
@@ -422,6 +438,30 @@ public:
         const std::string& registry_filename, const std::string& globals_filename);
     void restart(ConfigGraph* graph);
 
+    /**
+       Read in the components that an incremental checkpoint blob file
+       references in earlier checkpoints.  The references are in the
+       section at offset, which follows the component blobs in the
+       file.
+     */
+    void restart_read_blob_references(const Checkpointing::BlobFile& blob, uint64_t offset,
+        const std::string& filename, const std::string& checkpoint_directory);
+
+    /**
+       Helpers for reading checkpoint blob files on restart.  These
+       call fatal() if the file can't be opened or is truncated.
+     */
+    void   restart_open_blob(Checkpointing::BlobFile& blob, const std::string& filename);
+    char*  restart_blob_section(
+        const Checkpointing::BlobFile& blob, uint64_t& offset, size_t& size, const std::string& filename);
+    size_t restart_blob_count(const Checkpointing::BlobFile& blob, uint64_t& offset, const std::string& filename);
+
+    /**
+       Number of threads this partition uses to compress or decompress
+       the blocks of a checkpoint blob file (see --checkpoint-compress)
+     */
+    int checkpointCompressionThreads() const;
+
     void discoverRemoteLinks();
 
     /**** Functions/variables needed for discoverRemoteLinks() ****/
@@ -560,6 +600,11 @@ public:
     std::string             interactive_msg_;
     SimTime_t               stop_at_ = 0;
 
+    // Set when run() should pop activities with the same delivery
+    // time and priority from the TimeVortex as a batch
+    bool                   batch_dispatch_ = false;
+    std::vector<Activity*> activity_batch_;
+
     uint32_t next_link_order_tag_ = 1;
 
     /**
@@ -576,8 +621,34 @@ public:
      */
     std::vector<std::pair<ComponentId_t, uint64_t>> component_blob_offsets_;
 
+    /**
+       Where each component's blob was last written and a hash of its
+       contents.  Used by incremental checkpoints to skip components
+       that haven't changed since the last checkpoint.
+     */
+    struct CheckpointBlobLocation
+    {
+        size_t      hash;
+        size_t      size;
+        std::string filename; // Relative to a checkpoint's directory
+        uint64_t    offset;
+    };
+    std::unordered_map<ComponentId_t, CheckpointBlobLocation> checkpoint_blob_locations_;
+
+    /**
+       Components that reference their blob in an earlier checkpoint
+     */
+    std::vector<ComponentId_t> component_blob_reused_;
+
     pvt::TimeVortexSort tv_sort_;
 
+    /**
+       Thread writing the last checkpoint file in the background when
+       checkpoint-async is set
+     */
+    std::thread       checkpoint_writer_;
+    std::atomic<bool> checkpoint_write_failed_ { false };
+
     /** TimeLord of the simulation */
     static TimeLord timeLord;
     /** Output */
@@ -17,6 +17,12 @@
 #include "sst/core/statapi/statoutput.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <type_traits>
+#include <vector>
+
 namespace SST::Statistics {
 
 // NOTE: When calling base class members in classes derived from
@@ -30,7 +36,10 @@ namespace SST::Statistics {
 
 /**
     \class HistogramStatistic
-    Holder of data grouped into pre-determined width bins.
+    Holder of data grouped into pre-determined width bins.  The bin
+    counts are kept in a flat array indexed by bin number, unless there
+    are so many bins that the array would be too large, in which case
+    only the bins that have been used are stored.
     \tparam BinDataType is the type of the data held in each bin (i.e. what data type described the width of the bin)
 */
 #define CountType   uint64_t
@@ -83,6 +92,8 @@ public:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_activeBinCount   = 0;
+        if ( m_numBins <= MAX_DENSE_BINS ) m_bins.resize(m_numBins, 0);
         this->setCollectionCount(0);
     }
 
@@ -105,6 +116,8 @@ public:
         SST_SER(m_itemsBinnedCount);
         SST_SER(m_totalSummed);
         SST_SER(m_totalSummedSqr);
+        SST_SER(m_activeBinCount);
+        SST_SER(m_bins);
         SST_SER(m_binsMap);
         SST_SER(m_dumpBinsOnOutput);
         SST_SER(m_includeOutOfBounds);
@@ -113,8 +126,7 @@ public:
 
 protected:
     /**
-        Adds a new value to the histogram. The correct bin is identified and then incremented. If no bin can be found
-        to hold the value then a new bin is created.
+        Adds a new value to the histogram. The correct bin is identified and then incremented.
     */
     void addData_impl_Ntimes(uint64_t N, BinDataType value) override
     {
@@ -136,35 +148,50 @@ protected:
         // Increment the Binned count (note this <= to the Statistics added Item Count)
         m_itemsBinnedCount++;
 
-        // Figure out what the starting bin is and find it in the map
-        // To support signed and unsigned values along with floating point types,
-        // the calculation to find the bin_start value must be done in floating point
-        // then converted to BinDataType
-        double      calc1     = (double)value / (double)m_binWidth;
-        double      calc2     = floor(calc1); // Find the floor of the value
-        double      calc3     = m_binWidth * calc2;
-        BinDataType bin_start = (BinDataType)calc3;
-        //      printf("DEBUG: value = %d, junk1 = %f, calc2 = %f, calc3 = %f : bin_start = %d, item count = %ld, \n",
-        //      value, calc1, calc2, calc3, bin_start, getStatCollectionCount());
-
-        HistoMapItr_t bin_itr = m_binsMap.find(bin_start);
-
-        // Was the bin found?
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, Create the bin and set a value of 1 to it
-            m_binsMap.insert(std::pair<BinDataType, CountType>(bin_start, (CountType)N));
+        // Bins start at the min value, so the bin number is the offset
+        // from it divided by the bin width
+        NumBinsType bin = getBinIndex(value);
+        if ( isDense() ) {
+            if ( m_bins[bin] == 0 ) m_activeBinCount++;
+            m_bins[bin] += N;
         }
         else {
-            // Yes, Increment the specific bin's count
-            bin_itr->second += N;
+            CountType& count = m_binsMap[bin];
+            if ( count == 0 ) m_activeBinCount++;
+            count += N;
         }
     }
 
     void addData_impl(BinDataType value) override { addData_impl_Ntimes(1, value); }
 
 private:
+    /** Histograms with more bins than this only store the bins that have been used */
+    static constexpr NumBinsType MAX_DENSE_BINS = 1 << 20;
+
+    /** Whether the bin counts are in the flat array */
+    bool isDense() const { return m_numBins <= MAX_DENSE_BINS; }
+
+    /**
+        Get the bin number of a value that is within the bounds of the histogram.  Integer values are binned with
+        integer arithmetic.
+    */
+    NumBinsType getBinIndex(BinDataType value)
+    {
+        if constexpr ( std::is_integral_v<BinDataType> ) {
+            // Unsigned subtraction gives the right offset even when
+            // the signed difference would overflow
+            return (NumBinsType)(((uint64_t)value - (uint64_t)m_minValue) / m_binWidth);
+        }
+        else {
+            // Rounding can put values just below the max value in the
+            // bin past the end
+            double bin = std::floor(((double)value - (double)m_minValue) / (double)m_binWidth);
+            return bin < m_numBins ? (NumBinsType)bin : m_numBins - 1;
+        }
+    }
+
     /** Count how many bins are active in this histogram */
-    NumBinsType getActiveBinCount() { return m_binsMap.size(); }
+    NumBinsType getActiveBinCount() { return m_activeBinCount; }
 
     /** Count how many bins are available */
     NumBinsType getNumBins() { return m_numBins; }
@@ -173,23 +200,15 @@ private:
     NumBinsType getBinWidth() { return m_binWidth; }
 
     /**
-        Get the count of items in the bin by the start value (e.g. give me the count of items in the bin which begins at
-       value X). \return The count of items in the bin else 0.
+        Get the count of items in a bin by its bin number
+        \return The count of items in the bin else 0.
     */
-    CountType getBinCountByBinStart(BinDataType binStartValue)
+    CountType getBinCount(NumBinsType bin)
     {
-        // Find the Bin Start Value in the Bin Map
-        HistoMapItr_t bin_itr = m_binsMap.find(binStartValue);
+        if ( isDense() ) return m_bins[bin];
 
-        // Check to see if the Start Value was found
-        if ( bin_itr == m_binsMap.end() ) {
-            // No, return no count for this bin
-            return (CountType)0;
-        }
-        else {
-            // Yes, return the bin count
-            return m_binsMap[binStartValue];
-        }
+        auto bin_itr = m_binsMap.find(bin);
+        return bin_itr == m_binsMap.end() ? (CountType)0 : bin_itr->second;
     }
 
     /**
@@ -247,6 +266,8 @@ private:
         m_OOBMinCount      = 0;
         m_OOBMaxCount      = 0;
         m_itemsBinnedCount = 0;
+        m_activeBinCount   = 0;
+        std::fill(m_bins.begin(), m_bins.end(), 0);
         m_binsMap.clear();
         this->setCollectionCount(0);
     }
@@ -306,21 +327,15 @@ private:
 
         // Do we also need to dump the bin counts on output
         if ( true == m_dumpBinsOnOutput ) {
-            BinDataType currentBinValue = getBinsMinValue();
             for ( uint32_t y = 0; y < getNumBins(); y++ ) {
-                statOutput->outputField(m_Fields[x++], getBinCountByBinStart(currentBinValue));
-                // Increment the currentBinValue to get the next bin
-                currentBinValue += getBinWidth();
+                statOutput->outputField(m_Fields[x++], getBinCount(y));
             }
         }
     }
 
 private:
-    // Bin Map Definition
-    using HistoMap_t = std::map<BinDataType, CountType>;
-
-    // Iterator over the histogram bins
-    using HistoMapItr_t = typename HistoMap_t::iterator;
+    // Bin Map Definition, used when there are too many bins for the flat array
+    using HistoMap_t = std::map<NumBinsType, CountType>;
 
     // The minimum value in the Histogram
     BinDataType m_minValue;
@@ -347,7 +362,13 @@ private:
     // values such as variance.
     BinDataType m_totalSummedSqr;
 
-    // A map of the the bin starts to the bin counts
+    // Number of bins with a non-zero count
+    NumBinsType m_activeBinCount;
+
+    // The bin counts, indexed by bin number
+    std::vector<CountType> m_bins;
+
+    // A map of the bin numbers to the bin counts when m_bins isn't used
     HistoMap_t m_binsMap;
 
     // Support
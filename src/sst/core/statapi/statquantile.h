@@ -0,0 +1,350 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_STATAPI_STATQUANTILE_H
+#define SST_CORE_STATAPI_STATQUANTILE_H
+
+#include "sst/core/output.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/statapi/statbase.h"
+#include "sst/core/statapi/statoutput.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace SST::Statistics {
+
+/**
+    \class QuantileSketch
+
+    Bounded memory summary of a distribution in the style of an HDR
+    histogram.  Each power of two is split into 2^precision equal width
+    buckets, so every value is kept to within a relative error of
+    2^-precision and the memory used only depends on the range of the
+    values, not on how many there are.  Sketches are merged by adding
+    their bucket counts.
+*/
+class QuantileSketch
+{
+public:
+    explicit QuantileSketch(uint32_t precision = 7) :
+        precision_(precision)
+    {
+        clear();
+    }
+
+    /** Add count copies of value to the sketch.  Infinities and NaNs are ignored. */
+    void add(double value, uint64_t count = 1)
+    {
+        if ( count == 0 || !std::isfinite(value) ) return;
+        if ( value > 0.0 )
+            positive_.add(bucketIndex(value), count);
+        else if ( value < 0.0 )
+            negative_.add(bucketIndex(-value), count);
+        else
+            zero_count_ += count;
+        count_ += count;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    /**
+        Add the contents of other to this sketch.  If the sketches don't
+        have the same precision, other's buckets are rebinned at this
+        sketch's precision.
+    */
+    void merge(const QuantileSketch& other)
+    {
+        if ( other.count_ == 0 ) return;
+        if ( other.precision_ == precision_ ) {
+            positive_.merge(other.positive_);
+            negative_.merge(other.negative_);
+        }
+        else {
+            for ( size_t i = 0; i < other.positive_.counts.size(); ++i )
+                positive_.add(bucketIndex(other.bucketValue(other.positive_.offset + i)), other.positive_.counts[i]);
+            for ( size_t i = 0; i < other.negative_.counts.size(); ++i )
+                negative_.add(bucketIndex(other.bucketValue(other.negative_.offset + i)), other.negative_.counts[i]);
+        }
+        zero_count_ += other.zero_count_;
+        count_ += other.count_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    /**
+        Get the value at quantile q, where q is between 0 and 1.  The
+        result is the middle of the bucket holding the value of that
+        rank, clamped to the smallest and largest values added.
+    */
+    double quantile(double q) const
+    {
+        if ( count_ == 0 ) return 0.0;
+        if ( q <= 0.0 ) return min_;
+        if ( q >= 1.0 ) return max_;
+
+        // Nearest rank, walking the buckets from the most negative value
+        uint64_t target = std::max<uint64_t>(1, (uint64_t)std::ceil(q * count_));
+        uint64_t seen   = 0;
+        for ( size_t i = negative_.counts.size(); i-- > 0; ) {
+            seen += negative_.counts[i];
+            if ( seen >= target ) return clamp(-bucketValue(negative_.offset + i));
+        }
+        seen += zero_count_;
+        if ( seen >= target ) return 0.0;
+        for ( size_t i = 0; i < positive_.counts.size(); ++i ) {
+            seen += positive_.counts[i];
+            if ( seen >= target ) return clamp(bucketValue(positive_.offset + i));
+        }
+        return max_;
+    }
+
+    uint64_t getCount() const { return count_; }
+    double   getMin() const { return min_; }
+    double   getMax() const { return max_; }
+    uint32_t getPrecision() const { return precision_; }
+
+    void clear()
+    {
+        positive_.counts.clear();
+        negative_.counts.clear();
+        zero_count_ = 0;
+        count_      = 0;
+        min_        = std::numeric_limits<double>::infinity();
+        max_        = -std::numeric_limits<double>::infinity();
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser)
+    {
+        SST_SER(precision_);
+        SST_SER(positive_.offset);
+        SST_SER(positive_.counts);
+        SST_SER(negative_.offset);
+        SST_SER(negative_.counts);
+        SST_SER(zero_count_);
+        SST_SER(count_);
+        SST_SER(min_);
+        SST_SER(max_);
+    }
+
+private:
+    /** Bucket counts for a contiguous range of bucket indices */
+    struct Buckets
+    {
+        int64_t               offset = 0;
+        std::vector<uint64_t> counts;
+
+        void add(int64_t index, uint64_t count)
+        {
+            if ( counts.empty() ) {
+                offset = index;
+                counts.push_back(0);
+            }
+            else if ( index < offset ) {
+                counts.insert(counts.begin(), offset - index, 0);
+                offset = index;
+            }
+            else if ( index - offset >= (int64_t)counts.size() ) {
+                counts.resize(index - offset + 1, 0);
+            }
+            counts[index - offset] += count;
+        }
+
+        void merge(const Buckets& other)
+        {
+            if ( other.counts.empty() ) return;
+            // Size the range once, then add the counts in place
+            add(other.offset, 0);
+            add(other.offset + other.counts.size() - 1, 0);
+            for ( size_t i = 0; i < other.counts.size(); ++i )
+                counts[other.offset - offset + i] += other.counts[i];
+        }
+    };
+
+    /** Index of the bucket holding a positive magnitude */
+    int64_t bucketIndex(double magnitude) const
+    {
+        // magnitude = fraction * 2^exp, with fraction in [0.5, 1)
+        int     exp;
+        double  fraction = std::frexp(magnitude, &exp);
+        int64_t sub      = (int64_t)std::ldexp(fraction - 0.5, precision_ + 1);
+        return (int64_t)exp * bucketsPerExp() + sub;
+    }
+
+    /** Middle of the range of magnitudes held by a bucket */
+    double bucketValue(int64_t index) const
+    {
+        // Round the exponent down for negative indices too
+        int64_t per = bucketsPerExp();
+        int64_t exp = index >= 0 ? index / per : -((per - 1 - index) / per);
+        int64_t sub = index - exp * per;
+        return std::ldexp(0.5 + (sub + 0.5) / (2.0 * per), (int)exp);
+    }
+
+    int64_t bucketsPerExp() const { return int64_t(1) << precision_; }
+
+    double clamp(double value) const { return std::min(std::max(value, min_), max_); }
+
+    uint32_t precision_;
+    Buckets  positive_;
+    Buckets  negative_;
+    uint64_t zero_count_;
+    uint64_t count_;
+    double   min_;
+    double   max_;
+};
+
+/**
+    \class QuantileStatistic
+
+    Reports quantiles (such as the median or the 99th percentile) of
+    the values presented to it without having to choose bins ahead of
+    time.  The values are summarized in a QuantileSketch, so the memory
+    used is bounded and quantiles are accurate to within a relative
+    error set by the precision parameter.
+
+    @tparam T A template for holding the main data type of this statistic
+*/
+template <typename T>
+class QuantileStatistic : public Statistic<T>
+{
+public:
+    SST_ELI_DECLARE_STATISTIC_TEMPLATE_DERIVED(
+        QuantileStatistic,
+        T,
+        "sst",
+        "QuantileStatistic",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Track quantiles of a statistic using a bounded memory sketch",
+        "SST::Statistic<T>")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"precision", "Bits of precision kept for each value.  Reported quantiles are within a relative error of 2^-precision.  Must be between 1 and 16.", "7"},
+        {"quantiles", "List of the quantiles to report, given as percentages.", "[50, 90, 99, 99.9]"})
+
+    QuantileStatistic(
+        BaseComponent* comp, const std::string& stat_name, const std::string& stat_sub_id, Params& stat_params) :
+        Statistic<T>(comp, stat_name, stat_sub_id, stat_params)
+    {
+        stat_params.pushAllowedKeys({ "precision", "quantiles" });
+
+        uint32_t precision = stat_params.find<uint32_t>("precision", 7);
+        if ( precision < 1 || precision > 16 ) {
+            Output::getDefaultObject().fatal(CALL_INFO_LONG, 1,
+                "ERROR: QuantileStatistic %s: precision must be between 1 and 16, got %" PRIu32 "\n",
+                this->getFullStatName().c_str(), precision);
+        }
+        sketch_ = QuantileSketch(precision);
+
+        stat_params.find_array<double>("quantiles", quantiles_);
+        if ( quantiles_.empty() ) quantiles_ = { 50, 90, 99, 99.9 };
+        for ( double q : quantiles_ ) {
+            if ( q < 0.0 || q > 100.0 ) {
+                Output::getDefaultObject().fatal(CALL_INFO_LONG, 1,
+                    "ERROR: QuantileStatistic %s: quantiles must be between 0 and 100, got %g\n",
+                    this->getFullStatName().c_str(), q);
+            }
+        }
+    }
+
+    ~QuantileStatistic() {}
+
+    QuantileStatistic() :
+        Statistic<T>()
+    {} // For serialization ONLY
+
+    virtual const std::string& getStatTypeName() const override { return stat_type_; }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        SST::Statistics::Statistic<T>::serialize_order(ser);
+        sketch_.serialize_order(ser);
+        SST_SER(quantiles_);
+        // Field handles will be reset by statistics output object
+    }
+
+    /**
+        Add the values collected by another QuantileStatistic, such as
+        the same statistic in another component, to this one
+    */
+    void merge(const QuantileStatistic<T>& other) { sketch_.merge(other.sketch_); }
+
+    /** Get the value at quantile q, where q is between 0 and 1 */
+    T getQuantile(double q) const { return toValue(sketch_.quantile(q)); }
+
+protected:
+    void addData_impl(T data) override { sketch_.add((double)data); }
+
+    void addData_impl_Ntimes(uint64_t N, T data) override { sketch_.add((double)data, N); }
+
+private:
+    /** Convert a value from the sketch back to the statistic's type */
+    static T toValue(double value)
+    {
+        if constexpr ( std::is_integral_v<T> )
+            return (T)std::llround(value);
+        else
+            return (T)value;
+    }
+
+    void clearStatisticData() override
+    {
+        sketch_.clear();
+        this->setCollectionCount(0);
+    }
+
+    void registerOutputFields(StatisticFieldsOutput* stat_output) override
+    {
+        h_count_ = stat_output->registerField<uint64_t>("Count");
+        h_min_   = stat_output->registerField<T>("Min");
+        h_max_   = stat_output->registerField<T>("Max");
+        h_quantiles_.clear();
+        for ( double q : quantiles_ ) {
+            // Field names can't contain a '.', so p99.9 becomes p99_9
+            std::stringstream ss;
+            ss << "p" << q;
+            std::string name = ss.str();
+            std::replace(name.begin(), name.end(), '.', '_');
+            h_quantiles_.push_back(stat_output->registerField<T>(name.c_str()));
+        }
+    }
+
+    void outputStatisticFields(StatisticFieldsOutput* stat_output, bool UNUSED(end_of_sim_flag)) override
+    {
+        stat_output->outputField(h_count_, sketch_.getCount());
+        stat_output->outputField(h_min_, sketch_.getCount() ? toValue(sketch_.getMin()) : T(0));
+        stat_output->outputField(h_max_, sketch_.getCount() ? toValue(sketch_.getMax()) : T(0));
+        for ( size_t i = 0; i < quantiles_.size(); ++i )
+            stat_output->outputField(h_quantiles_[i], getQuantile(quantiles_[i] / 100.0));
+    }
+
+    QuantileSketch      sketch_;
+    std::vector<double> quantiles_;
+
+    StatisticOutput::fieldHandle_t              h_count_;
+    StatisticOutput::fieldHandle_t              h_min_;
+    StatisticOutput::fieldHandle_t              h_max_;
+    std::vector<StatisticOutput::fieldHandle_t> h_quantiles_;
+
+    inline static const std::string stat_type_ = "Quantile";
+};
+
+} // namespace SST::Statistics
+
+#endif // SST_CORE_STATAPI_STATQUANTILE_H
@@ -0,0 +1,222 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncPairwiseSkip.h"
+
+#include "sst/core/output.h"
+#include "sst/core/profile.h"
+#include "sst/core/simulation.h"
+#include "sst/core/sst_mpi.h"
+#include "sst/core/sync/syncQueue.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace SST {
+
+RankSyncPairwiseSkip::RankSyncPairwiseSkip(RankInfo num_ranks) :
+    RankSyncSerialSkip(num_ranks)
+{}
+
+RankSyncPairwiseSkip::~RankSyncPairwiseSkip()
+{
+    if ( global_syncs_ > 0 || pair_syncs_ > 0 )
+        Output::getDefaultObject().verbose(CALL_INFO, 1, 0,
+            "RankSyncPairwiseSkip global syncs: %" PRIu64 "  pair syncs: %" PRIu64 "\n", global_syncs_, pair_syncs_);
+}
+
+SimTime_t
+RankSyncPairwiseSkip::getNextSyncTime()
+{
+    SimTime_t next = myNextSyncTime;
+    for ( auto& p : pairs_ ) {
+        if ( p.second.next_sync < next ) next = p.second.next_sync;
+    }
+    return next;
+}
+
+bool
+RankSyncPairwiseSkip::isGlobalSync()
+{
+    return getNextSyncTime() == myNextSyncTime;
+}
+
+void
+RankSyncPairwiseSkip::requireGlobalSync(SimTime_t time)
+{
+    if ( time < myNextSyncTime ) myNextSyncTime = time;
+}
+
+void
+RankSyncPairwiseSkip::setRestartTime(SimTime_t time)
+{
+    // The pair schedules will start over after the first global sync
+    RankSyncSerialSkip::setRestartTime(time);
+    for ( auto& p : pairs_ ) {
+        p.second.next_sync = MAX_SIMTIME_T;
+    }
+}
+
+void
+RankSyncPairwiseSkip::execute(int thread)
+{
+    if ( thread != 0 ) return;
+
+    if ( isGlobalSync() ) {
+        globalExchange();
+    }
+    else {
+        pairExchange();
+    }
+}
+
+void
+RankSyncPairwiseSkip::globalExchange()
+{
+    if ( !lookahead_ready_ ) computeLookahead();
+
+    exchange();
+    global_syncs_++;
+
+    // exchange() scheduled the next global sync max_period past the
+    // global minimum time.  Nothing is in flight between the ranks,
+    // so the pair schedules can start over from that same minimum.
+    resetPairSyncs(myNextSyncTime - max_period);
+}
+
+void
+RankSyncPairwiseSkip::pairExchange()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    SimTime_t now       = Simulation::getSimulation()->getCurrentSimCycle();
+    SimTime_t local_min = Simulation::getLocalMinimumNextActivityTime();
+
+    // Events from the other neighbors can't show up until the next
+    // exchange with them, so the earliest this rank can send to a
+    // neighbor is the earliest of its next local event and the next
+    // exchange with any other neighbor.  Track the two lowest pair
+    // times so the one for the pair itself can be left out.
+    SimTime_t first      = MAX_SIMTIME_T;
+    SimTime_t second     = MAX_SIMTIME_T;
+    int       first_rank = -1;
+    for ( auto& p : pairs_ ) {
+        if ( p.second.next_sync < first ) {
+            second     = first;
+            first      = p.second.next_sync;
+            first_rank = p.first;
+        }
+        else if ( p.second.next_sync < second ) {
+            second = p.second.next_sync;
+        }
+    }
+
+    std::vector<comm_map_t::iterator> due;
+    std::vector<SimTime_t>            lower_bounds;
+    for ( auto& p : pairs_ ) {
+        if ( p.second.next_sync > now ) continue;
+        due.push_back(comm_map.find(p.first));
+    }
+
+    auto sreqs      = std::make_unique<MPI_Request[]>(2 * due.size());
+    auto rreqs      = std::make_unique<MPI_Request[]>(due.size());
+    int  sreq_count = 0;
+    int  rreq_count = 0;
+
+    for ( auto i : due ) {
+        char* send_buffer = i->second.squeue->getData();
+
+        SimTime_t bound = std::min(local_min, i->first == first_rank ? second : first);
+        bound           = std::min(bound, i->second.squeue->getMinDeliveryTime());
+
+        RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
+        hdr->lower_bound           = bound;
+        lower_bounds.push_back(bound);
+
+        postExchange(i, send_buffer, sreqs.get(), sreq_count, &rreqs[rreq_count++]);
+    }
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs.get(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( size_t x = 0; x < due.size(); ++x ) {
+        comm_map_t::iterator i = due[x];
+        deliverData(i, true);
+
+        // Both sides see the same two bounds, so they agree on the
+        // time of the next exchange
+        RankSyncQueue::Header* hdr   = reinterpret_cast<RankSyncQueue::Header*>(i->second.rbuf);
+        SimTime_t              bound = std::min(lower_bounds[x], hdr->lower_bound);
+        pair_sync&             pair  = pairs_[i->first];
+        pair.next_sync               = bound > MAX_SIMTIME_T - pair.lookahead ? MAX_SIMTIME_T : bound + pair.lookahead;
+    }
+
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs.get(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    pair_syncs_++;
+#endif
+}
+
+void
+RankSyncPairwiseSkip::computeLookahead()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // findSyncInterval() only gave us the latency of the links coming
+    // in from each neighbor.  Both sides of a pair need to use the same
+    // lookahead, so swap them and use the lower of the two directions.
+    std::vector<SimTime_t> remote(comm_map.size());
+
+    auto sreqs = std::make_unique<MPI_Request[]>(comm_map.size());
+    auto rreqs = std::make_unique<MPI_Request[]>(comm_map.size());
+    int  count = 0;
+    for ( auto i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        MPI_Isend(&min_recv_latency[i->first], 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &sreqs[count]);
+        MPI_Irecv(&remote[count], 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &rreqs[count]);
+        count++;
+    }
+    MPI_Waitall(count, rreqs.get(), MPI_STATUSES_IGNORE);
+    MPI_Waitall(count, sreqs.get(), MPI_STATUSES_IGNORE);
+
+    SimTime_t min_lookahead = MAX_SIMTIME_T;
+    count                   = 0;
+    for ( auto i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        pair_sync& pair = pairs_[i->first];
+        pair.lookahead  = std::min(min_recv_latency[i->first], remote[count++]);
+        pair.next_sync  = MAX_SIMTIME_T;
+        if ( pair.lookahead < min_lookahead ) min_lookahead = pair.lookahead;
+    }
+
+    // The global syncs only need to happen often enough to keep the
+    // rank with the slowest pair syncs checking in, so use the largest
+    // of the per-rank minimum lookaheads.  Ranks without any neighbors
+    // don't get a say.
+    SimTime_t input = min_lookahead == MAX_SIMTIME_T ? 0 : min_lookahead;
+    SimTime_t global_period;
+    MPI_Allreduce(&input, &global_period, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    if ( global_period > max_period ) max_period = global_period;
+#endif
+    lookahead_ready_ = true;
+}
+
+void
+RankSyncPairwiseSkip::resetPairSyncs(SimTime_t base)
+{
+    for ( auto& p : pairs_ ) {
+        p.second.next_sync = base > MAX_SIMTIME_T - p.second.lookahead ? MAX_SIMTIME_T : base + p.second.lookahead;
+    }
+}
+
+} // namespace SST
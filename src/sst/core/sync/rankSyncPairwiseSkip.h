@@ -0,0 +1,88 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCPAIRWISESKIP_H
+#define SST_CORE_SYNC_RANKSYNCPAIRWISESKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/rankSyncSerialSkip.h"
+
+#include <map>
+
+namespace SST {
+
+/**
+   RankSync that tracks the lookahead separately for each pair of
+   neighboring ranks.  Each pair exchanges events at a rate set by the
+   lowest latency link between the two of them, so ranks that only
+   share long latency links sync much less often than the ones that
+   share short latency links.
+
+   At each pair exchange, both sides send a lower bound on when they
+   can next send an event to the other (the earliest of their next
+   local event, the next exchange with any of their other neighbors
+   and the events in the exchange).  The next exchange for the pair
+   is the lower of the two bounds plus the pair's lookahead.
+
+   A global exchange with all neighbors still happens periodically to
+   handle signals, flags, checkpoints and the exit check.  The global
+   period is the largest of the per-rank minimum lookaheads.
+
+   Only used when running with one thread per rank.
+ */
+class RankSyncPairwiseSkip : public RankSyncSerialSkip
+{
+public:
+    /** Create a new Sync object */
+    explicit RankSyncPairwiseSkip(RankInfo num_ranks);
+    RankSyncPairwiseSkip() {} // For serialization
+    virtual ~RankSyncPairwiseSkip();
+
+    void execute(int thread) override;
+
+    SimTime_t getNextSyncTime() override;
+    bool      isGlobalSync() override;
+    void      requireGlobalSync(SimTime_t time) override;
+
+    void setRestartTime(SimTime_t time) override;
+
+private:
+    // Exchange with every neighbor and then reset the pair schedules
+    void globalExchange();
+
+    // Exchange with the neighbors whose pair sync is due
+    void pairExchange();
+
+    // Agree on the lookahead for each neighbor and the global period.
+    // Called at the first global exchange.
+    void computeLookahead();
+
+    // Start each pair schedule over from the time base
+    void resetPairSyncs(SimTime_t base);
+
+    struct pair_sync
+    {
+        SimTime_t lookahead;
+        SimTime_t next_sync;
+    };
+
+    // Indexed by rank
+    std::map<int, pair_sync> pairs_;
+
+    bool lookahead_ready_ = false;
+
+    uint64_t global_syncs_ = 0;
+    uint64_t pair_syncs_   = 0;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCPAIRWISESKIP_H
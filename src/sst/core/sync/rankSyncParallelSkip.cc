@@ -533,11 +533,8 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
-
         std::vector<Activity*> activities;
-        SST_SER(activities);
+        RankSyncQueue::unpackData(buffer, activities);
 
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
@@ -565,16 +562,11 @@ RankSyncParallelSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::at
 void
 RankSyncParallelSkip::deserializeMessage(comm_recv_pair* msg)
 {
-    char*                  buffer = msg->rbuf;
-    RankSyncQueue::Header* hdr    = reinterpret_cast<RankSyncQueue::Header*>(buffer);
-    unsigned int           size   = hdr->buffer_size;
+    char* buffer = msg->rbuf;
 
     auto deserialStart = SST::Core::Profile::now();
 
-    SST::Core::Serialization::serializer ser;
-
-    ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
-    SST_SER(msg->activity_vec);
+    RankSyncQueue::unpackData(buffer, msg->activity_vec);
 
     deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
 }
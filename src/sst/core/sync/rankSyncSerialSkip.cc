@@ -24,6 +24,7 @@
 #include "sst/core/sync/syncQueue.h"
 #include "sst/core/timeConverter.h"
 
+#include <algorithm>
 #include <atomic>
 
 #if SST_EVENT_PROFILING
@@ -45,10 +46,11 @@ namespace SST {
 // Static Data Members
 SimTime_t RankSyncSerialSkip::myNextSyncTime = 0;
 
-RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks) :
+RankSyncSerialSkip::RankSyncSerialSkip(RankInfo num_ranks, bool overlap) :
     RankSync(num_ranks),
     mpiWaitTime(0.0),
-    deserializeTime(0.0)
+    deserializeTime(0.0),
+    overlap_(overlap)
 {
     max_period     = Simulation::getSimulation()->getMinPartTC().getFactor();
     myNextSyncTime = max_period;
@@ -104,7 +106,11 @@ RankSyncSerialSkip::finalizeLinkConfigurations()
 
 void
 RankSyncSerialSkip::prepareForComplete()
-{}
+{
+    // Events still in flight won't be delivered, but the requests
+    // need to complete before the untimed data is exchanged
+    finishPendingExchange(false);
+}
 
 void
 RankSyncSerialSkip::setSignals(int end, int usr, int alrm)
@@ -201,7 +207,22 @@ void
 RankSyncSerialSkip::execute(int thread)
 {
     if ( thread == 0 ) {
-        exchange();
+        // The overlapped exchange splits the lookahead in half, so it
+        // needs a lookahead of at least 2
+        if ( overlap_ && max_period >= 2 ) {
+            exchangeOverlap();
+        }
+        else {
+            exchange();
+        }
+    }
+}
+
+void
+RankSyncSerialSkip::completeExchange(int thread)
+{
+    if ( thread == 0 ) {
+        finishPendingExchange(true);
     }
 }
 
@@ -216,7 +237,8 @@ RankSyncSerialSkip::exchange()
     int  sreq_count = 0;
     int  rreq_count = 0;
 
-    Simulation* sim = Simulation::getSimulation();
+    // Only used when event profiling is enabled
+    [[maybe_unused]] Simulation* sim = Simulation::getSimulation();
 
     for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
 
@@ -228,74 +250,15 @@ RankSyncSerialSkip::exchange()
 
         SST_EVENT_PROFILE_STOP
 
-        // Cast to Header so we can get/fill in data
-        RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-        // Simulation::getSimulation()->getSimulationOutput().output("Data size = %d\n", hdr->buffer_size);
-        int                    tag = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
-
-        // Post all the receives
-        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+        postExchange(i, send_buffer, sreqs.get(), sreq_count, &rreqs[rreq_count++]);
     }
 
     // Wait for all sends and recvs to complete
-    SimTime_t current_cycle = sim->getCurrentSimCycle();
-
     auto waitStart = SST::Core::Profile::now();
     MPI_Waitall(rreq_count, rreqs.get(), MPI_STATUSES_IGNORE);
     mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
 
-    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
-        // Get the buffer and deserialize all the events
-        char* buffer = i->second.rbuf;
-
-        RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
-        unsigned int           size = hdr->buffer_size;
-        int                    mode = hdr->mode;
-
-        if ( mode == 1 ) {
-            // May need to resize the buffer
-            if ( size > i->second.local_size ) {
-                delete[] i->second.rbuf;
-                i->second.rbuf       = new char[size];
-                i->second.local_size = size;
-            }
-            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-            buffer = i->second.rbuf;
-        }
-
-        auto deserialStart = SST::Core::Profile::now();
-
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
-
-        std::vector<Activity*> activities;
-        activities.clear();
-        SST_SER(activities);
-
-        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
-
-        for ( unsigned int j = 0; j < activities.size(); j++ ) {
-            Event*    ev    = static_cast<Event*>(activities[j]);
-            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
-            getDeliveryLink(ev)->send(delay, ev);
-        }
-
-        activities.clear();
-    }
+    deliverData(true);
 
     // Clear the RankSyncQueues used to send the data after all the sends have completed
     waitStart = SST::Core::Profile::now();
@@ -321,6 +284,169 @@ RankSyncSerialSkip::exchange()
 
     myNextSyncTime = min_time + max_period;
 
+    exchangeSignalsAndFlags();
+#endif
+}
+
+void
+RankSyncSerialSkip::exchangeOverlap()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Deliver the data sent at the last sync.  This also makes sure
+    // the send buffers are done being used before they are refilled.
+    finishPendingExchange(true);
+
+    pending_sreqs_.resize(2 * comm_map.size());
+    pending_rreqs_.resize(comm_map.size());
+    int sreq_count = 0;
+    int rreq_count = 0;
+
+    // Only used when event profiling is enabled
+    [[maybe_unused]] Simulation* sim = Simulation::getSimulation();
+
+    SimTime_t min_delivery = MAX_SIMTIME_T;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        SST_EVENT_PROFILE_START
+
+        // Get the buffer from the syncQueue.  This also empties the
+        // queue, so events sent from here on will go out at the next
+        // sync.
+        char* send_buffer = i->second.squeue->getData();
+
+        SST_EVENT_PROFILE_STOP
+
+        if ( i->second.squeue->getMinDeliveryTime() < min_delivery ) {
+            min_delivery = i->second.squeue->getMinDeliveryTime();
+        }
+
+        postExchange(i, send_buffer, pending_sreqs_.data(), sreq_count, &pending_rreqs_[rreq_count++]);
+    }
+    pending_sreqs_.resize(sreq_count);
+    pending_rreqs_.resize(rreq_count);
+    exchange_pending_ = true;
+
+    // The data just sent will be delivered at the next sync, so that
+    // sync can't be later than the earliest event in it.  Anything
+    // sent after this sync can't be delivered until max_period after
+    // the global minimum, so limiting the next window to half of
+    // max_period means the sync after that will still have something
+    // to wait for.
+    SimTime_t input[2] = { Simulation::getLocalMinimumNextActivityTime(), min_delivery };
+    SimTime_t min_times[2];
+    MPI_Allreduce(&input, &min_times, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+
+    myNextSyncTime = std::min(min_times[1], min_times[0] + max_period / 2);
+
+    exchangeSignalsAndFlags();
+#endif
+}
+
+void
+RankSyncSerialSkip::finishPendingExchange(bool UNUSED_WO_MPI(deliver))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !exchange_pending_ ) return;
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(pending_rreqs_.size(), pending_rreqs_.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    deliverData(deliver);
+
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(pending_sreqs_.size(), pending_sreqs_.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    pending_sreqs_.clear();
+    pending_rreqs_.clear();
+    exchange_pending_ = false;
+#endif
+}
+
+void
+RankSyncSerialSkip::deliverData(bool deliver)
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        deliverData(i, deliver);
+    }
+}
+
+#ifdef SST_CONFIG_HAVE_MPI
+void
+RankSyncSerialSkip::postExchange(
+    comm_map_t::iterator i, char* send_buffer, MPI_Request* sreqs, int& sreq_count, MPI_Request* rreq)
+{
+    // Cast to Header so we can get/fill in data
+    RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
+    int                    tag = 1;
+    // Check to see if remote queue is big enough for data
+    if ( i->second.remote_size < hdr->buffer_size ) {
+        // not big enough, send message that will tell remote side to get larger buffer
+        hdr->mode = 1;
+        MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+            &sreqs[sreq_count++]);
+        i->second.remote_size = hdr->buffer_size;
+        tag                   = 2;
+    }
+    else {
+        hdr->mode = 0;
+    }
+    MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+    // Post the receive
+    MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, rreq);
+}
+#endif
+
+void
+RankSyncSerialSkip::deliverData(comm_map_t::iterator UNUSED_WO_MPI(i), bool UNUSED_WO_MPI(deliver))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    SimTime_t current_cycle = Simulation::getSimulation()->getCurrentSimCycle();
+
+    // Get the buffer and deserialize all the events
+    char* buffer = i->second.rbuf;
+
+    RankSyncQueue::Header* hdr  = reinterpret_cast<RankSyncQueue::Header*>(buffer);
+    unsigned int           size = hdr->buffer_size;
+    int                    mode = hdr->mode;
+
+    if ( mode == 1 ) {
+        // May need to resize the buffer
+        if ( size > i->second.local_size ) {
+            delete[] i->second.rbuf;
+            i->second.rbuf       = new char[size];
+            i->second.local_size = size;
+        }
+        MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        buffer = i->second.rbuf;
+    }
+
+    auto deserialStart = SST::Core::Profile::now();
+
+    std::vector<Activity*> activities;
+    RankSyncQueue::unpackData(buffer, activities);
+
+    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+    for ( unsigned int j = 0; j < activities.size(); j++ ) {
+        if ( !deliver ) {
+            delete activities[j];
+            continue;
+        }
+        Event*    ev    = static_cast<Event*>(activities[j]);
+        SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+        getDeliveryLink(ev)->send(delay, ev);
+    }
+#endif
+}
+
+void
+RankSyncSerialSkip::exchangeSignalsAndFlags()
+{
+#ifdef SST_CONFIG_HAVE_MPI
     int32_t local_signals[3]  = { sig_end_, sig_usr_, sig_alrm_ };
     int32_t global_signals[3] = { 0, 0, 0 };
     MPI_Allreduce(&local_signals, &global_signals, 3, MPI_INT32_T, MPI_MAX, MPI_COMM_WORLD);
@@ -338,7 +464,6 @@ RankSyncSerialSkip::exchange()
     enter_shutdown_    = global_flags[1];
     shutdown_mode_     = global_flags[2];
     generate_ckpt_     = global_flags[3];
-
 #endif
 }
 
@@ -361,27 +486,8 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
 
         // Do all the sends
         // Get the buffer from the syncQueue
-        char*                  send_buffer = i->second.squeue->getData();
-        // Cast to Header so we can get/fill in data
-        RankSyncQueue::Header* hdr         = reinterpret_cast<RankSyncQueue::Header*>(send_buffer);
-        int                    tag         = 1;
-        // Check to see if remote queue is big enough for data
-        if ( i->second.remote_size < hdr->buffer_size ) {
-            // not big enough, send message that will tell remote side to get larger buffer
-            hdr->mode = 1;
-            MPI_Isend(send_buffer, sizeof(RankSyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
-                &sreqs[sreq_count++]);
-            i->second.remote_size = hdr->buffer_size;
-            tag                   = 2;
-        }
-        else {
-            hdr->mode = 0;
-        }
-        MPI_Isend(
-            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
-
-        // Post all the receives
-        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+        char* send_buffer = i->second.squeue->getData();
+        postExchange(i, send_buffer, sreqs.get(), sreq_count, &rreqs[rreq_count++]);
     }
 
     // Wait for all recvs to complete
@@ -407,11 +513,8 @@ RankSyncSerialSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atom
             buffer = i->second.rbuf;
         }
 
-        SST::Core::Serialization::serializer ser;
-        ser.start_unpacking(&buffer[sizeof(RankSyncQueue::Header)], size - sizeof(RankSyncQueue::Header));
-
         std::vector<Activity*> activities;
-        SST_SER(activities);
+        RankSyncQueue::unpackData(buffer, activities);
         for ( unsigned int j = 0; j < activities.size(); j++ ) {
 
             Event* ev = static_cast<Event*>(activities[j]);
@@ -12,6 +12,7 @@
 #ifndef SST_CORE_SYNC_RANKSYNCSERIALSKIP_H
 #define SST_CORE_SYNC_RANKSYNCSERIALSKIP_H
 
+#include "sst/core/sst_mpi.h"
 #include "sst/core/sst_types.h"
 #include "sst/core/sync/syncManager.h"
 #include "sst/core/threadsafe.h"
@@ -20,6 +21,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace SST {
 
@@ -33,14 +35,22 @@ class SyncProfileToolList;
 class RankSyncSerialSkip : public RankSync
 {
 public:
-    /** Create a new Sync object which fires with a specified period */
-    explicit RankSyncSerialSkip(RankInfo num_ranks);
+    /**
+       Create a new Sync object which fires with a specified period
+
+       @param num_ranks Number of ranks and threads in the simulation
+
+       @param overlap If true, the data sent at each sync is delivered
+       at the following sync so the ranks don't wait for it to arrive
+     */
+    explicit RankSyncSerialSkip(RankInfo num_ranks, bool overlap = false);
     RankSyncSerialSkip() {} // For serialization
     virtual ~RankSyncSerialSkip();
 
     /** Register a Link which this Sync Object is responsible for */
     ActivityQueue* registerLink(const RankInfo& to_rank, const RankInfo& from_rank, Link* link) override;
     void           execute(int thread) override;
+    void           completeExchange(int thread) override;
 
     /** Cause an exchange of Untimed Data to occur */
     void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
@@ -74,12 +84,9 @@ public:
 
     void setProfileToolList(Profile::SyncProfileToolList* profile_tools) override;
 
-private:
+protected:
     static SimTime_t myNextSyncTime;
 
-    // Function that actually does the exchange during run
-    void exchange();
-
     struct comm_pair : public SST::Core::Serialization::serializable
     {
         RankSyncQueue* squeue; // RankSyncQueue
@@ -92,15 +99,59 @@ private:
     };
 
     using comm_map_t = std::map<int, comm_pair>;
-    using link_map_t = std::map<std::string, uintptr_t>;
 
-    // TimeConverter* period;
+    // Function that actually does the exchange during run
+    void exchange();
+
+#ifdef SST_CONFIG_HAVE_MPI
+    // Post the sends of send_buffer and the receive for a single
+    // rank.  Uses up to two entries in sreqs and one in rreq.
+    void postExchange(
+        comm_map_t::iterator i, char* send_buffer, MPI_Request* sreqs, int& sreq_count, MPI_Request* rreq);
+#endif
+
+    // Deserialize the data in the receive buffer for a single rank
+    // and either deliver or delete the events
+    void deliverData(comm_map_t::iterator i, bool deliver);
+
     comm_map_t comm_map;
-    link_map_t link_map;
 
     double mpiWaitTime;
     double deserializeTime;
 
+private:
+
+    // Exchange used when overlap_ is set.  Sends the data collected
+    // since the last sync, but doesn't wait for the data coming in.
+    // That data is delivered at the next sync, so the next sync is
+    // scheduled no later than the earliest event sent and no more
+    // than half of max_period past the global minimum time.
+    void exchangeOverlap();
+
+    // Wait for the data from an overlapped exchange and either
+    // deliver it or delete it
+    void finishPendingExchange(bool deliver);
+
+    // Deserialize the data in the receive buffers and either deliver
+    // or delete the events
+    void deliverData(bool deliver);
+
+    // Global reduction of the signals and flags
+    void exchangeSignalsAndFlags();
+
+    using link_map_t = std::map<std::string, uintptr_t>;
+
+    // TimeConverter* period;
+    link_map_t link_map;
+
+    bool overlap_          = false;
+    bool exchange_pending_ = false;
+#ifdef SST_CONFIG_HAVE_MPI
+    // Requests for the overlapped exchange that is in flight
+    std::vector<MPI_Request> pending_sreqs_;
+    std::vector<MPI_Request> pending_rreqs_;
+#endif
+
     Profile::SyncProfileToolList* profile_tools_ = nullptr;
 
     Core::ThreadSafe::Spinlock   lock;
@@ -21,6 +21,7 @@
 #include "sst/core/realtime.h"
 #include "sst/core/simulation.h"
 #include "sst/core/sst_mpi.h"
+#include "sst/core/sync/rankSyncPairwiseSkip.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
 #include "sst/core/sync/syncQueue.h"
@@ -320,6 +321,7 @@ RankSync::findSyncInterval(uint32_t UNUSED_WO_MPI(my_rank))
             // Added receive latency is found in local->latency
             SimTime_t total_latency = x.first + local->latency;
             if ( total_latency < low_latency ) low_latency = total_latency;
+            if ( total_latency < min_recv_latency[i] ) min_recv_latency[i] = total_latency;
         }
         // Clear data for the next iteration
         data.clear();
@@ -362,6 +364,7 @@ RankSync::findSyncInterval(uint32_t UNUSED_WO_MPI(my_rank))
             // Added receive latency is found in local->latency
             SimTime_t total_latency = x.first + local->latency;
             if ( total_latency < low_latency ) low_latency = total_latency;
+            if ( total_latency < min_recv_latency[i] ) min_recv_latency[i] = total_latency;
         }
         // Clear data for the next iteration
         data.clear();
@@ -388,8 +391,11 @@ SyncManager::setupSyncObjects()
             b.resize(num_ranks_.thread);
         }
         if ( min_part_ != MAX_SIMTIME_T ) {
-            if ( num_ranks_.thread == 1 ) {
-                rankSync_ = new RankSyncSerialSkip(num_ranks_);
+            if ( num_ranks_.thread == 1 && sim_->config.rank_sync_pairwise() ) {
+                rankSync_ = new RankSyncPairwiseSkip(num_ranks_);
+            }
+            else if ( num_ranks_.thread == 1 ) {
+                rankSync_ = new RankSyncSerialSkip(num_ranks_, sim_->config.rank_sync_overlap());
             }
             else {
                 rankSync_ = new RankSyncParallelSkip(num_ranks_);
@@ -413,10 +419,12 @@ SyncManager::setupSyncObjects()
     SimTime_t interthread_minlat = sim_->getInterThreadMinLatency();
     if ( num_ranks_.thread > 1 && interthread_minlat != MAX_SIMTIME_T ) {
         if ( sim_->direct_interthread ) {
-            threadSync_ = new ThreadSyncDirectSkip(num_ranks_.thread, rank_.thread, sim_);
+            threadSync_ = new ThreadSyncDirectSkip(
+                num_ranks_.thread, rank_.thread, sim_, sim_->config.dissemination_barrier());
         }
         else {
-            threadSync_ = new ThreadSyncSimpleSkip(num_ranks_.thread, rank_.thread, sim_);
+            threadSync_ = new ThreadSyncSimpleSkip(
+                num_ranks_.thread, rank_.thread, sim_, sim_->config.dissemination_barrier());
         }
     }
     else {
@@ -567,6 +575,15 @@ SyncManager::execute()
 
     switch ( next_sync_type_ ) {
     case RANK:
+        // A sync that only includes some of the neighboring ranks
+        // just exchanges events.  Everything else waits for the next
+        // global sync.  These are only used with one thread per rank.
+        if ( !rankSync_->isGlobalSync() ) {
+            rankSync_->execute(rank_.thread);
+            next_checkpoint_time = checkpoint_->getNextCheckpointSimTime();
+            break;
+        }
+
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
         // queues.
@@ -622,6 +639,11 @@ SyncManager::execute()
         if ( generate_ckpt ) {
             checkpoint_->setCheckpoint();
         }
+        // There can't be any events in flight between ranks when the
+        // checkpoint is written
+        if ( checkpoint_->getCheckpoint() || getDeliveryTime() == checkpoint_->getNextCheckpointSimTime() ) {
+            rankSync_->completeExchange(rank_.thread);
+        }
         next_checkpoint_time = checkpoint_->check(getDeliveryTime());
 
         if ( interactive_enabled ) {
@@ -794,6 +816,12 @@ SyncManager::computeNextInsert(SimTime_t next_checkpoint_time)
         }
     }
 
+    // Checkpoints need all of the ranks, so the rank sync needs to be
+    // a global one
+    if ( num_ranks_.rank > 1 && next_checkpoint_time <= next_rank_sync ) {
+        rankSync_->requireGlobalSync(next_checkpoint_time);
+    }
+
     sim_->insertActivity(next_sync_time, this);
 }
 
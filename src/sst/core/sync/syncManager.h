@@ -49,6 +49,7 @@ public:
         num_ranks_(num_ranks)
     {
         link_maps.resize(num_ranks_.rank);
+        min_recv_latency.resize(num_ranks_.rank, MAX_SIMTIME_T);
     }
     RankSync() {}
     virtual ~RankSync() {}
@@ -60,6 +61,12 @@ public:
 
     virtual void execute(int thread)                                              = 0;
     virtual void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) = 0;
+
+    /**
+       Finish any exchange that execute() left in flight, delivering
+       the received events.  Called before a checkpoint is written.
+    */
+    virtual void completeExchange(int UNUSED(thread)) {}
     virtual void finalizeLinkConfigurations()                                     = 0;
     virtual void prepareForComplete()                                             = 0;
 
@@ -81,6 +88,19 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /**
+       Returns true if the sync at getNextSyncTime() includes all of
+       the ranks.  Signals, flags, checkpoints and the exit check are
+       only handled at global syncs.
+    */
+    virtual bool isGlobalSync() { return true; }
+
+    /**
+       Make sure there is a global sync no later than time.  Used to
+       line the syncs up with sim time checkpoints.
+    */
+    virtual void requireGlobalSync(SimTime_t UNUSED(time)) {}
+
     virtual void setRestartTime(SimTime_t time) { nextSyncTime = time; }
 
     void      setMaxPeriod(SimTime_t period) { max_period = period; }
@@ -106,6 +126,12 @@ protected:
     */
     std::vector<std::vector<std::pair<uint64_t, uintptr_t>>> link_maps;
 
+    /**
+       Minimum total latency of the links coming in from each rank.
+       Filled in by findSyncInterval().
+    */
+    std::vector<SimTime_t> min_recv_latency;
+
     void finalizeConfiguration(Link* link) { link->finalizeConfiguration(); }
 
     void prepareForCompleteInt(Link* link) { link->prepareForComplete(); }
@@ -18,6 +18,7 @@
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/simulation.h"
 
+#include <cstring>
 #include <mutex>
 
 namespace SST {
@@ -25,10 +26,24 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+// Event tracking adds data to Event that the trivially copyable path
+// doesn't send, so all events need to be serialized
+static bool
+useTrivialPayload(Event* UNUSED(ev), void*& UNUSED(payload), size_t& UNUSED(size))
+{
+    return false;
+}
+#else
+static bool
+useTrivialPayload(Event* ev, void*& payload, size_t& size)
+{
+    return ev->getTrivialPayload(payload, size);
+}
+#endif
+
 RankSyncQueue::RankSyncQueue(RankInfo to_rank) :
-    SyncQueue(to_rank),
-    buffer(nullptr),
-    buf_size(0)
+    SyncQueue(to_rank)
 {}
 
 bool
@@ -85,37 +100,119 @@ RankSyncQueue::getData()
 
     serializer ser;
 
-    ser.start_sizing();
-
-    SST_SER(activities);
-
-    size_t size = ser.size();
-
-    if ( profile_tools_ ) profile_tools_->updateSyncSize(size, activities.size());
-
-    if ( buf_size < (size + sizeof(RankSyncQueue::Header)) ) {
-        if ( buffer != nullptr ) {
-            delete[] buffer;
+    // Events are appended to the buffer in a single pass.  Events with
+    // a trivially copyable payload are copied directly into the
+    // buffer; everything else goes through the serializer and has the
+    // size in its header filled in afterwards.
+    buffer.resize(sizeof(RankSyncQueue::Header));
+    min_delivery_time = MAX_SIMTIME_T;
+    for ( auto* activity : activities ) {
+        if ( activity->getDeliveryTime() < min_delivery_time ) min_delivery_time = activity->getDeliveryTime();
+        Event*      ev           = static_cast<Event*>(activity);
+        void*       payload      = nullptr;
+        size_t      payload_size = 0;
+        EventHeader ev_hdr;
+        size_t      hdr_offset = buffer.size();
+        if ( useTrivialPayload(ev, payload, payload_size) ) {
+            ev_hdr.cls_id = ev->cls_id();
+            ev_hdr.size   = payload_size;
+
+            DeliveryHeader dhdr;
+            dhdr.delivery_time = ev->getDeliveryTime();
+            dhdr.queue_order   = ev->getQueueOrder();
+            dhdr.delivery_info = ev->delivery_info;
+            dhdr.priority      = ev->getPriority();
+            dhdr.order_tag     = ev->getOrderTag();
+
+            buffer.resize(hdr_offset + sizeof(EventHeader) + sizeof(DeliveryHeader) + payload_size);
+            char* next = buffer.data() + hdr_offset;
+            std::memcpy(next, &ev_hdr, sizeof(EventHeader));
+            next += sizeof(EventHeader);
+            std::memcpy(next, &dhdr, sizeof(DeliveryHeader));
+            next += sizeof(DeliveryHeader);
+            if ( payload_size > 0 ) std::memcpy(next, payload, payload_size);
+            continue;
         }
+        buffer.resize(hdr_offset + sizeof(EventHeader));
+        ser.start_packing(buffer);
+        SST_SER(activity);
 
-        buf_size = size + sizeof(RankSyncQueue::Header);
-        buffer   = new char[buf_size];
+        ev_hdr.cls_id = serializable_base::NullClsId;
+        ev_hdr.size   = ser.size();
+        std::memcpy(buffer.data() + hdr_offset, &ev_hdr, sizeof(EventHeader));
     }
 
-    ser.start_packing(buffer + sizeof(RankSyncQueue::Header), size);
-
-    SST_SER(activities);
+    size_t size = buffer.size() - sizeof(RankSyncQueue::Header);
+    if ( profile_tools_ ) profile_tools_->updateSyncSize(size, activities.size());
 
     // Delete all the events
     for ( unsigned int i = 0; i < activities.size(); i++ ) {
         delete activities[i];
     }
+
+    // Set the count and size fields in the header
+    RankSyncQueue::Header* hdr = static_cast<RankSyncQueue::Header*>(static_cast<void*>(buffer.data()));
+    hdr->count                 = activities.size();
+    hdr->buffer_size           = buffer.size();
+    hdr->lower_bound           = 0;
+
     activities.clear();
 
-    // Set the size field in the header
-    static_cast<RankSyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(RankSyncQueue::Header);
+    return buffer.data();
+}
+
+void
+RankSyncQueue::unpackData(char* buffer, std::vector<Activity*>& activities)
+{
+    RankSyncQueue::Header* hdr = reinterpret_cast<RankSyncQueue::Header*>(buffer);
+
+    activities.clear();
+    activities.reserve(hdr->count);
 
-    return buffer;
+    serializer ser;
+    char*      next = buffer + sizeof(RankSyncQueue::Header);
+    for ( uint32_t i = 0; i < hdr->count; ++i ) {
+        EventHeader ev_hdr;
+        std::memcpy(&ev_hdr, next, sizeof(EventHeader));
+        next += sizeof(EventHeader);
+
+        if ( ev_hdr.cls_id == serializable_base::NullClsId ) {
+            Activity* activity = nullptr;
+            ser.start_unpacking(next, ev_hdr.size);
+            SST_SER(activity);
+            activities.push_back(activity);
+            next += ev_hdr.size;
+            continue;
+        }
+
+        // Trivially copyable event.  Construct a new one and copy the
+        // delivery information and payload into it.
+        Event* ev = static_cast<Event*>(serializable_factory::get_serializable(ev_hdr.cls_id));
+
+        DeliveryHeader dhdr;
+        std::memcpy(&dhdr, next, sizeof(DeliveryHeader));
+        next += sizeof(DeliveryHeader);
+
+        ev->setDeliveryTime(dhdr.delivery_time);
+        ev->setQueueOrder(dhdr.queue_order);
+        ev->delivery_info = dhdr.delivery_info;
+        ev->setPriority(static_cast<uint64_t>(dhdr.priority));
+        ev->setOrderTag(dhdr.order_tag);
+
+        void*  payload      = nullptr;
+        size_t payload_size = 0;
+        ev->getTrivialPayload(payload, payload_size);
+        if ( payload_size != ev_hdr.size ) {
+            Simulation::getSimulationOutput().fatal(CALL_INFO, 1,
+                "ERROR: Payload size for trivially copyable event of type %s does not match between ranks (%" PRIu32
+                " sent, %zu expected)\n",
+                ev->cls_name(), ev_hdr.size, payload_size);
+        }
+        if ( payload_size > 0 ) std::memcpy(payload, next, payload_size);
+        next += payload_size;
+
+        activities.push_back(ev);
+    }
 }
 
 } // namespace SST
@@ -14,6 +14,7 @@
 
 #include "sst/core/activityQueue.h"
 #include "sst/core/rankInfo.h"
+#include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
 #include <cstddef>
@@ -63,9 +64,12 @@ class RankSyncQueue : public SyncQueue
 public:
     struct Header
     {
-        uint32_t mode;
-        uint32_t count;
-        uint32_t buffer_size;
+        uint32_t  mode;
+        uint32_t  count;
+        uint32_t  buffer_size;
+        // Earliest time the sender can send another event to the
+        // receiving rank.  Only used by RankSyncPairwiseSkip.
+        SimTime_t lower_bound;
     };
 
     explicit RankSyncQueue(RankInfo to_rank);
@@ -83,14 +87,57 @@ public:
     /** Accessor method to the internal queue */
     char* getData();
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    /**
+       Rebuild the events from a buffer created by getData() on a
+       remote rank
+
+       @param buffer Buffer to unpack, starting with the Header
+
+       @param activities Vector to put the events in.  Any existing
+       contents are removed.
+     */
+    static void unpackData(char* buffer, std::vector<Activity*>& activities);
+
+    /**
+       Get the earliest delivery time of the events in the buffer
+       returned by the last call to getData().  Returns MAX_SIMTIME_T
+       if there were no events.
+     */
+    SimTime_t getMinDeliveryTime() const { return min_delivery_time; }
+
+    uint64_t getDataSize() { return buffer.capacity() + (activities.capacity() * sizeof(Activity*)); }
 
     void setProfileTools(Profile::SyncProfileToolList* profile_tools) override { profile_tools_ = profile_tools; }
 
 private:
-    char*                         buffer;
-    size_t                        buf_size;
+    /*
+      Each event in the buffer starts with an EventHeader.  Events with
+      a trivially copyable payload (see Event::getTrivialPayload()) are
+      followed by a DeliveryHeader and then size bytes of payload, and
+      are rebuilt without calling serialize_order().  All other events
+      have cls_id set to serializable_base::NullClsId and are followed
+      by size bytes of serialized data.
+    */
+    struct EventHeader
+    {
+        uint32_t cls_id;
+        uint32_t size;
+    };
+
+    struct DeliveryHeader
+    {
+        SimTime_t delivery_time;
+        uint64_t  queue_order;
+        uintptr_t delivery_info;
+        int32_t   priority;
+        uint32_t  order_tag;
+    };
+
+    // Events are packed onto the end of the buffer, which grows as
+    // needed and keeps its capacity between calls to getData()
+    std::vector<char>             buffer;
     std::vector<Activity*>        activities;
+    SimTime_t                     min_delivery_time = MAX_SIMTIME_T;
     Profile::SyncProfileToolList* profile_tools_ = nullptr;
 
     Core::ThreadSafe::Spinlock slock;
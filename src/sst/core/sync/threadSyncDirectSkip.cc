@@ -27,17 +27,23 @@ namespace SST {
 SimTime_t ThreadSyncDirectSkip::localMinimumNextActivityTime = 0;
 
 /** Create a new ThreadSyncDirectSkip object */
-ThreadSyncDirectSkip::ThreadSyncDirectSkip(int num_threads, int thread, Simulation* sim) :
+ThreadSyncDirectSkip::ThreadSyncDirectSkip(int num_threads, int thread, Simulation* sim, bool dissemination_barrier) :
     ThreadSync(),
     num_threads(num_threads),
     thread(thread),
     sim(sim),
-    totalWaitTime(0.0)
+    totalWaitTime(0.0),
+    use_dissemination_(dissemination_barrier)
 {
     if ( sim->getRank().thread == 0 ) {
         barrier[0].resize(num_threads);
         barrier[1].resize(num_threads);
         barrier[2].resize(num_threads);
+        if ( dissemination_barrier ) {
+            dissemination_barrier_[0].resize(num_threads);
+            dissemination_barrier_[1].resize(num_threads);
+            dissemination_barrier_[2].resize(num_threads);
+        }
     }
 
     if ( sim->getNumRanks().rank > 1 )
@@ -76,7 +82,7 @@ void
 ThreadSyncDirectSkip::execute()
 {
     after();
-    totalWaitTime += barrier[2].wait();
+    totalWaitTime += waitBarrier(2);
 }
 
 uint64_t
@@ -152,13 +158,21 @@ ThreadSyncDirectSkip::clearFlags()
     shutdown_mode_.store(0);
 }
 
-Core::ThreadSafe::Barrier ThreadSyncDirectSkip::barrier[3];
-int                       ThreadSyncDirectSkip::sig_end_(0);
-int                       ThreadSyncDirectSkip::sig_usr_(0);
-int                       ThreadSyncDirectSkip::sig_alrm_(0);
-std::atomic<bool>         ThreadSyncDirectSkip::enter_interactive_(false);
-std::atomic<bool>         ThreadSyncDirectSkip::enter_shutdown_(false);
-std::atomic<unsigned>     ThreadSyncDirectSkip::shutdown_mode_(0);
+double
+ThreadSyncDirectSkip::waitBarrier(int index)
+{
+    if ( use_dissemination_ ) return dissemination_barrier_[index].wait(thread);
+    return barrier[index].wait();
+}
+
+Core::ThreadSafe::Barrier              ThreadSyncDirectSkip::barrier[3];
+Core::ThreadSafe::DisseminationBarrier ThreadSyncDirectSkip::dissemination_barrier_[3];
+int                                    ThreadSyncDirectSkip::sig_end_(0);
+int                                    ThreadSyncDirectSkip::sig_usr_(0);
+int                                    ThreadSyncDirectSkip::sig_alrm_(0);
+std::atomic<bool>                      ThreadSyncDirectSkip::enter_interactive_(false);
+std::atomic<bool>                      ThreadSyncDirectSkip::enter_shutdown_(false);
+std::atomic<unsigned>                  ThreadSyncDirectSkip::shutdown_mode_(0);
 
 
 } // namespace SST
@@ -36,8 +36,13 @@ class ThreadSyncQueue;
 class ThreadSyncDirectSkip : public ThreadSync
 {
 public:
-    /** Create a new ThreadSync object */
-    ThreadSyncDirectSkip(int num_threads, int thread, Simulation* sim);
+    /**
+       Create a new ThreadSync object
+
+       @param dissemination_barrier If true, use a DisseminationBarrier
+       instead of the shared counter Barrier
+     */
+    ThreadSyncDirectSkip(int num_threads, int thread, Simulation* sim, bool dissemination_barrier = false);
     ThreadSyncDirectSkip() {} // For serialization only
     ~ThreadSyncDirectSkip();
 
@@ -90,6 +95,13 @@ private:
     static std::atomic<bool>         enter_interactive_;
     static std::atomic<bool>         enter_shutdown_;
     static std::atomic<unsigned>     shutdown_mode_;
+
+    // Used instead of barrier when use_dissemination_ is set
+    static Core::ThreadSafe::DisseminationBarrier dissemination_barrier_[3];
+    bool                                          use_dissemination_ = false;
+
+    // Wait on whichever barrier is in use
+    double waitBarrier(int index);
 };
 
 
@@ -28,12 +28,13 @@ namespace SST {
 SimTime_t ThreadSyncSimpleSkip::localMinimumNextActivityTime = 0;
 
 /** Create a new ThreadSyncSimpleSkip object */
-ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulation* sim) :
+ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulation* sim, bool dissemination_barrier) :
     ThreadSync(),
     num_threads(num_threads),
     thread(thread),
     sim(sim),
-    totalWaitTime(0.0)
+    totalWaitTime(0.0),
+    use_dissemination_(dissemination_barrier)
 {
     RankInfo rank = sim->getRank();
     for ( int i = 0; i < num_threads; i++ ) {
@@ -44,6 +45,11 @@ ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulati
         barrier[0].resize(num_threads);
         barrier[1].resize(num_threads);
         barrier[2].resize(num_threads);
+        if ( dissemination_barrier ) {
+            dissemination_barrier_[0].resize(num_threads);
+            dissemination_barrier_[1].resize(num_threads);
+            dissemination_barrier_[2].resize(num_threads);
+        }
     }
 
     if ( sim->getNumRanks().rank > 1 )
@@ -137,11 +143,11 @@ ThreadSyncSimpleSkip::after()
 void
 ThreadSyncSimpleSkip::execute()
 {
-    totalWaitTime = barrier[0].wait();
+    totalWaitTime = waitBarrier(0);
     before();
-    totalWaitTime = barrier[1].wait();
+    totalWaitTime = waitBarrier(1);
     after();
-    totalWaitTime += barrier[2].wait();
+    totalWaitTime += waitBarrier(2);
 }
 
 void
@@ -199,7 +205,7 @@ ThreadSyncSimpleSkip::findSyncInterval()
     updateMinimumLatency(min_lat);
 
     // Need to barrier, then return the minimum latency
-    barrier[0].wait();
+    waitBarrier(0);
     return updateMinimumLatency();
 }
 
@@ -272,12 +278,20 @@ ThreadSyncSimpleSkip::clearFlags()
 }
 
 
-Core::ThreadSafe::Barrier ThreadSyncSimpleSkip::barrier[3];
-int                       ThreadSyncSimpleSkip::sig_end_(0);
-int                       ThreadSyncSimpleSkip::sig_usr_(0);
-int                       ThreadSyncSimpleSkip::sig_alrm_(0);
-std::atomic<bool>         ThreadSyncSimpleSkip::enter_interactive_(false);
-std::atomic<bool>         ThreadSyncSimpleSkip::enter_shutdown_(false);
-std::atomic<unsigned>     ThreadSyncSimpleSkip::shutdown_mode_(0);
+double
+ThreadSyncSimpleSkip::waitBarrier(int index)
+{
+    if ( use_dissemination_ ) return dissemination_barrier_[index].wait(thread);
+    return barrier[index].wait();
+}
+
+Core::ThreadSafe::Barrier              ThreadSyncSimpleSkip::barrier[3];
+Core::ThreadSafe::DisseminationBarrier ThreadSyncSimpleSkip::dissemination_barrier_[3];
+int                                    ThreadSyncSimpleSkip::sig_end_(0);
+int                                    ThreadSyncSimpleSkip::sig_usr_(0);
+int                                    ThreadSyncSimpleSkip::sig_alrm_(0);
+std::atomic<bool>                      ThreadSyncSimpleSkip::enter_interactive_(false);
+std::atomic<bool>                      ThreadSyncSimpleSkip::enter_shutdown_(false);
+std::atomic<unsigned>                  ThreadSyncSimpleSkip::shutdown_mode_(0);
 
 } // namespace SST
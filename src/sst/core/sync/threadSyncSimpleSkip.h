@@ -38,8 +38,13 @@ class ThreadSyncQueue;
 class ThreadSyncSimpleSkip : public ThreadSync
 {
 public:
-    /** Create a new ThreadSync object */
-    ThreadSyncSimpleSkip(int num_threads, int thread, Simulation* sim);
+    /**
+       Create a new ThreadSync object
+
+       @param dissemination_barrier If true, use a DisseminationBarrier
+       instead of the shared counter Barrier
+     */
+    ThreadSyncSimpleSkip(int num_threads, int thread, Simulation* sim, bool dissemination_barrier = false);
     ThreadSyncSimpleSkip() {} // For serialization only
     ~ThreadSyncSimpleSkip();
 
@@ -107,6 +112,13 @@ private:
     static std::atomic<bool>         enter_interactive_;
     static std::atomic<bool>         enter_shutdown_;
     static std::atomic<unsigned>     shutdown_mode_;
+
+    // Used instead of barrier when use_dissemination_ is set
+    static Core::ThreadSafe::DisseminationBarrier dissemination_barrier_[3];
+    bool                                          use_dissemination_ = false;
+
+    // Wait on whichever barrier is in use
+    double waitBarrier(int index);
 };
 
 } // namespace SST
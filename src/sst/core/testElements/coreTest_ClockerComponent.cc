@@ -35,6 +35,8 @@ coreTestClockerComponent::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(inst_link_);
     SST_SER(master_);
     SST_SER(clocks_);
+    SST_SER(sleeper_);
+    SST_SER(sleep_counter_);
 }
 
 
@@ -54,6 +56,11 @@ coreTestClockerComponent::coreTestClockerComponent(ComponentId_t id, Params& UNU
 
     if ( nullptr == left_ ) id_ = 0;
 
+    // The sleep clock starts out asleep.  It is put to sleep before the instruction link is configured so that links
+    // configured both before and after the first sleep will wake it up.
+    sleeper_ = registerClock<coreTestClockerComponent, &coreTestClockerComponent::sleep_handler>(test_tc, this);
+    sleepClockUntilEvent(sleeper_);
+
     inst_link_ = configureSelfLink(
         "inst_link", new Event::Handler<coreTestClockerComponent, &coreTestClockerComponent::inst_handler>(this));
 
@@ -186,4 +193,18 @@ coreTestClockerComponent::test_handler(Cycle_t cycle, int clock_index)
     return false;
 }
 
+bool
+coreTestClockerComponent::sleep_handler(Cycle_t cycle)
+{
+    if ( done_ ) return true;
+    getSimulationOutput().output("%d: Sleep clock at cycle %" PRIu64 "\n", id_, cycle);
+    sleep_counter_--;
+    if ( sleep_counter_ == 0 ) {
+        getSimulationOutput().output("%d: Sleep clock going to sleep at time %" PRIu64 "\n", id_, getCurrentSimCycle());
+        sleep_counter_ = total_count;
+        sleepClockUntilEvent(sleeper_);
+    }
+    return false;
+}
+
 } // namespace SST::CoreTestClockerComponent
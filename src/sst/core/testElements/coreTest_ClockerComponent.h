@@ -129,6 +129,12 @@ private:
         Period: 1ns
         - This clock will run until removed from the clock list by the master clock using deactivate(),
           The master clock will then restart it later using activate().
+
+      ** Clock that puts itself to sleep
+      Sleep clock:
+        Period: 1ns
+        - This clock will count X cycles, then put itself to sleep using sleepClockUntilEvent().  It is woken up by
+          the next event to arrive on any of the component's links, which will usually be the instruction self link.
      */
 
     // Struct to hold the data needed to manage the clocks
@@ -154,6 +160,12 @@ private:
     // Data for the clocks being tested
     std::vector<ClockInfo> clocks_;
 
+    // Handler and counter for the sleep clock
+    Clock::HandlerBase* sleeper_       = nullptr;
+    int64_t             sleep_counter_ = total_count;
+
+    bool sleep_handler(Cycle_t cycle);
+
 private:
 
     // Operations that the master handler can peform
@@ -23,6 +23,7 @@
 #include "sst/core/serialization/impl/serialize_utility.h"
 #include "sst/core/warnmacros.h"
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <deque>
@@ -1170,6 +1171,47 @@ coreTestSerialization::coreTestSerialization(ComponentId_t id, Params& params) :
         if ( !passed ) out.output("ERROR: vector<bool>* did not serialize/deserialize properly\n");
         delete vector_in_bool;
 
+        // A vector of trivially serializable elements is copied as one
+        // block.  Check that it can still read the data of a list,
+        // which is serialized element by element.
+        std::list<double> list_in_double;
+        for ( int i = 0; i < 1000; ++i )
+            list_in_double.push_back(rng->nextUniform());
+        std::vector<double> vector_out_double;
+        {
+            SST::Core::Serialization::serializer ser;
+            ser.start_sizing();
+            SST_SER(list_in_double);
+            size_t size   = ser.size();
+            auto   buffer = std::make_unique<char[]>(size);
+            ser.start_packing(buffer.get(), size);
+            SST_SER(list_in_double);
+            ser.start_unpacking(buffer.get(), size);
+            SST_SER(vector_out_double);
+        }
+        passed = std::equal(
+            list_in_double.begin(), list_in_double.end(), vector_out_double.begin(), vector_out_double.end());
+        if ( !passed ) out.output("ERROR: vector<double> did not deserialize list<double> properly\n");
+
+        // Packing into a growable buffer appends to what is already
+        // there and gives the same data as sizing first
+        {
+            SST::Core::Serialization::serializer ser;
+            ser.start_sizing();
+            SST_SER(list_in_double);
+            size_t            size = ser.size();
+            std::vector<char> sized(size);
+            ser.start_packing(sized.data(), size);
+            SST_SER(list_in_double);
+
+            std::vector<char> grown(3, 'x');
+            ser.start_packing(grown);
+            SST_SER(list_in_double);
+            passed = ser.size() == size && grown.size() == size + 3 &&
+                     std::equal(sized.begin(), sized.end(), grown.begin() + 3);
+        }
+        if ( !passed ) out.output("ERROR: list<double> did not pack into a growable buffer properly\n");
+
         std::list<int32_t>* list_in = new std::list<int32_t>();
         for ( int i = 0; i < 10; ++i )
             list_in->push_back(rng->generateNextInt32());
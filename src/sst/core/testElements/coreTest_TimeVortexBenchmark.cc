@@ -0,0 +1,103 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/testElements/coreTest_TimeVortexBenchmark.h"
+
+#include "sst/core/event.h"
+#include "sst/core/factory.h"
+#include "sst/core/output.h"
+#include "sst/core/rng/mersenne.h"
+#include "sst/core/timeVortex.h"
+
+#include <chrono>
+
+using namespace SST;
+using namespace SST::CoreTestTimeVortexBenchmark;
+
+TimeVortexBenchmark::TimeVortexBenchmark(ComponentId_t id, Params& params) :
+    Component(id)
+{
+    params.find_array<std::string>("timevortex", types);
+    if ( types.empty() ) {
+        types = { "sst.timevortex.priority_queue", "sst.timevortex.map.binned", "sst.timevortex.dary_heap" };
+    }
+
+    params.find_array<uint64_t>("sizes", sizes);
+    if ( sizes.empty() ) {
+        sizes.push_back(1000);
+    }
+
+    operations    = params.find<uint64_t>("operations", 1000000);
+    max_increment = params.find<uint32_t>("max_increment", 1000);
+    seed          = params.find<uint32_t>("seed", 1447);
+
+    if ( max_increment == 0 ) {
+        fatal(CALL_INFO, 1, "ERROR: max_increment must be greater than 0\n");
+    }
+}
+
+void
+TimeVortexBenchmark::setup()
+{
+    for ( auto size : sizes ) {
+        for ( auto& type : types ) {
+            runBenchmark(type, size);
+        }
+    }
+}
+
+void
+TimeVortexBenchmark::runBenchmark(const std::string& type, uint64_t size)
+{
+    Params      tv_params;
+    TimeVortex* tv = Factory::getFactory()->Create<TimeVortex>(type, tv_params);
+
+    // Use the same seed for every run so that each TimeVortex sees the
+    // identical sequence of delivery times
+    SST::RNG::MersenneRNG rng(seed);
+
+    for ( uint64_t i = 0; i < size; ++i ) {
+        Event* ev = new EmptyEvent();
+        ev->setDeliveryTime(rng.generateNextUInt32() % max_increment);
+        tv->insert(ev);
+    }
+
+    // The checksum only depends on the order events come out, so it
+    // must match across all of the TimeVortex implementations
+    uint64_t  checksum = 0;
+    SimTime_t last     = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for ( uint64_t i = 0; i < operations; ++i ) {
+        Activity* act  = tv->pop();
+        SimTime_t time = act->getDeliveryTime();
+        if ( time < last ) {
+            fatal(CALL_INFO, 1, "ERROR: %s returned events out of order (%" PRIu64 " after %" PRIu64 ")\n",
+                type.c_str(), time, last);
+        }
+        last     = time;
+        checksum = checksum * 31 + time;
+        act->setDeliveryTime(time + 1 + rng.generateNextUInt32() % max_increment);
+        tv->insert(act);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    // Deleting the TimeVortex deletes any events still in it
+    delete tv;
+
+    double elapsed = std::chrono::duration<double>(end - start).count();
+    getSimulationOutput().output("%s: size = %" PRIu64 ", operations = %" PRIu64 ", checksum = %" PRIu64 "\n",
+        type.c_str(), size, operations, checksum);
+    getSimulationOutput().output("# %s: size = %" PRIu64 ", time = %lf s, rate = %lf Mops/s\n", type.c_str(), size,
+        elapsed, elapsed > 0.0 ? (double)operations / elapsed / 1000000 : 0.0);
+}
@@ -0,0 +1,72 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+#define SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
+
+#include "sst/core/component.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST::CoreTestTimeVortexBenchmark {
+
+// Microbenchmark for the TimeVortex implementations.  Each requested
+// TimeVortex is filled with a fixed number of pending events and then
+// run through a hold model: pop the earliest event, move its delivery
+// time forward by a random amount and insert it again.  The component
+// does all of its work in setup() and has no links or clocks, so the
+// simulation itself ends immediately.
+class TimeVortexBenchmark : public SST::Component
+{
+public:
+    SST_ELI_REGISTER_COMPONENT(
+        TimeVortexBenchmark,
+        "coreTestElement",
+        "timeVortexBenchmark",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Measures insert/pop throughput of TimeVortex implementations",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "timevortex", "Array of TimeVortex types to measure",
+          "[sst.timevortex.priority_queue, sst.timevortex.map.binned, sst.timevortex.dary_heap]" },
+        { "sizes", "Array of the number of pending events to hold in the TimeVortex", "[1000]" },
+        { "operations", "Number of pop/insert pairs to time for each TimeVortex and size", "1000000" },
+        { "max_increment", "Maximum amount the delivery time of an event is moved forward on reinsert", "1000" },
+        { "seed", "Seed for the random number generator", "1447" }
+    )
+
+    SST_ELI_DOCUMENT_ATTRIBUTES(
+        { "test_element", "true" }
+    )
+
+    TimeVortexBenchmark(ComponentId_t id, Params& params);
+    ~TimeVortexBenchmark() {}
+
+    void setup() override;
+
+private:
+    // Run the hold model on a single TimeVortex type and size
+    void runBenchmark(const std::string& type, uint64_t size);
+
+    std::vector<std::string> types;
+    std::vector<uint64_t>    sizes;
+    uint64_t                 operations;
+    uint32_t                 max_increment;
+    uint32_t                 seed;
+};
+
+} // namespace SST::CoreTestTimeVortexBenchmark
+
+#endif // SST_CORE_CORETEST_TIMEVORTEXBENCHMARK_H
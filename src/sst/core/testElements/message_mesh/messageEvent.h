@@ -21,6 +21,15 @@ class MessageEvent : public SST::Event
 public:
     void serialize_order(SST::Core::Serialization::serializer& ser) override { Event::serialize_order(ser); }
 
+    // No data beyond what is in Event, so this can be sent between
+    // ranks without being serialized
+    bool getTrivialPayload(void*& payload, size_t& size) override
+    {
+        payload = nullptr;
+        size    = 0;
+        return true;
+    }
+
     ImplementSerializable(SST::CoreTest::MessageMesh::MessageEvent);
 };
 
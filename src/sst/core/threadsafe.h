@@ -131,6 +131,90 @@ public:
     }
 };
 
+/**
+   Barrier where each thread spins on its own cache line instead of a
+   shared counter.  This uses a dissemination barrier: in round r,
+   thread t signals thread (t + 2^r) % N and then waits for thread
+   (t - 2^r) % N to signal it, so every thread has heard from every
+   other thread after ceil(log2(N)) rounds.  Unlike Barrier, callers
+   need to pass in their thread number.
+ */
+class DisseminationBarrier
+{
+    struct CACHE_ALIGNED_T Flag
+    {
+        std::atomic<uint64_t> episode { 0 };
+    };
+
+    size_t num_threads = 0;
+    size_t rounds      = 0;
+
+    // Indexed by thread * rounds + round
+    std::vector<Flag> flags;
+    // Number of times each thread has entered the barrier
+    std::vector<Flag> episodes;
+
+public:
+    DisseminationBarrier() {}
+
+    explicit DisseminationBarrier(size_t count) { resize(count); }
+
+    /** ONLY call this while nobody is in wait() */
+    void resize(size_t newCount)
+    {
+        num_threads = newCount;
+        rounds      = 0;
+        while ( (size_t(1) << rounds) < num_threads )
+            rounds++;
+        flags    = std::vector<Flag>(num_threads * rounds);
+        episodes = std::vector<Flag>(num_threads);
+    }
+
+    /**
+     * Wait for all threads to reach this point.
+     * @param thread Thread number of the caller
+     * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
+     */
+    double wait(size_t thread)
+    {
+        double elapsed = 0.0;
+        if ( rounds == 0 ) return elapsed;
+
+        auto startTime = SST::Core::Profile::now();
+
+        // Only this thread touches its episode count
+        uint64_t episode = episodes[thread].episode.load(std::memory_order_relaxed) + 1;
+        episodes[thread].episode.store(episode, std::memory_order_relaxed);
+
+        size_t distance = 1;
+        for ( size_t round = 0; round < rounds; ++round, distance <<= 1 ) {
+            size_t partner = (thread + distance) % num_threads;
+            flags[partner * rounds + round].episode.store(episode, std::memory_order_release);
+
+            /* Try spinning first */
+            std::atomic<uint64_t>& mine  = flags[thread * rounds + round].episode;
+            uint32_t               count = 0;
+            while ( mine.load(std::memory_order_acquire) < episode ) {
+                count++;
+                if ( count < 1024 ) {
+                    sst_pause();
+                }
+                else if ( count < (1024 * 1024) ) {
+                    std::this_thread::yield();
+                }
+                else {
+                    struct timespec ts;
+                    ts.tv_sec  = 0;
+                    ts.tv_nsec = 1000;
+                    nanosleep(&ts, nullptr);
+                }
+            }
+        }
+        elapsed = SST::Core::Profile::getElapsed(startTime);
+        return elapsed;
+    }
+};
+
 #if 0
 using Spinlock = std::mutex;
 #else
@@ -342,6 +426,79 @@ public:
     }
 };
 
+/**
+   Unbounded, lock-free queue for a single producer and a single
+   consumer.  Storage is allocated in fixed size chunks; the producer
+   only ever writes to the tail chunk and the consumer frees chunks
+   once it has read past them, so neither side takes a lock.
+*/
+template <typename T, size_t ChunkSize = 256>
+class UnboundedSPSCQueue
+{
+    struct Chunk
+    {
+        T                   data[ChunkSize];
+        std::atomic<size_t> written;
+        std::atomic<Chunk*> next;
+
+        Chunk() :
+            written(0),
+            next(nullptr)
+        {}
+    };
+
+    // Only accessed by the consumer
+    CACHE_ALIGNED(Chunk*, head);
+    size_t head_pos;
+
+    // Only accessed by the producer
+    CACHE_ALIGNED(Chunk*, tail);
+    size_t tail_pos;
+
+public:
+    UnboundedSPSCQueue() :
+        head_pos(0),
+        tail_pos(0)
+    {
+        head = tail = new Chunk();
+    }
+
+    ~UnboundedSPSCQueue()
+    {
+        while ( head != nullptr ) {
+            Chunk* tmp = head;
+            head       = tmp->next;
+            delete tmp;
+        }
+    }
+
+    void insert(const T& t)
+    {
+        if ( tail_pos == ChunkSize ) {
+            Chunk* chunk = new Chunk();
+            tail->next.store(chunk, std::memory_order_release);
+            tail     = chunk;
+            tail_pos = 0;
+        }
+        tail->data[tail_pos++] = t;
+        tail->written.store(tail_pos, std::memory_order_release); // publish to consumer
+    }
+
+    bool try_remove(T& result)
+    {
+        if ( head_pos == ChunkSize ) {
+            Chunk* next = head->next.load(std::memory_order_acquire);
+            if ( next == nullptr ) return false;
+            delete head;
+            head     = next;
+            head_pos = 0;
+        }
+        if ( head_pos == head->written.load(std::memory_order_acquire) ) return false;
+        result = head->data[head_pos++];
+        return true;
+    }
+};
+
 // Replace with std::atomic_fetch_max at C++26
 template <typename T>
 void
@@ -48,6 +48,23 @@ TimeVortex::TimeVortex()
     // sim_ = Simulation::getSimulation();
 }
 
+void
+TimeVortex::popBatch(std::vector<Activity*>& batch)
+{
+    // Default implementation built on front() and pop().  Derived
+    // classes can override for a more efficient implementation
+    Activity* first = pop();
+    batch.push_back(first);
+
+    SimTime_t time     = first->getDeliveryTime();
+    int       priority = first->getPriority();
+    while ( !empty() ) {
+        Activity* next = front();
+        if ( next->getDeliveryTime() != time || next->getPriority() != priority ) break;
+        batch.push_back(pop());
+    }
+}
+
 void
 TimeVortex::print(Output& out) const
 {
@@ -45,6 +45,15 @@ public:
     virtual Activity* pop() override                      = 0;
     virtual Activity* front() override                    = 0;
 
+    /**
+       Pop the activity at the front of the queue along with all of
+       the activities that immediately follow it with the same
+       delivery time and priority.  Activities are appended to batch
+       in the same order pop() would have returned them.  The
+       TimeVortex must not be empty.
+     */
+    virtual void popBatch(std::vector<Activity*>& batch);
+
     /** Print the state of the TimeVortex */
     virtual void     print(Output& out) const;
     virtual uint64_t getMaxDepth() const { return max_depth; }
@@ -22,6 +22,7 @@ sst.setProgramOption("stop-at", "10us")
 ## [4] - Verbose output, optional
 ## [5] - Number of stats to register, optional
 ## [6] - Whether to enable stat output (0=disable, 1=dump-at-end, 2=dump at rate), optional
+## [7] - Latency of the Y links from the upper half of the rows, optional
 
 x_size = int(sys.argv[1])
 y_size = int(sys.argv[2])
@@ -42,6 +43,10 @@ stat_gen = 0 # No enable
 if len(sys.argv) > 6:
     stat_gen = int(sys.argv[6])
 
+slow_latency = "1ns"
+if len(sys.argv) > 7:
+    slow_latency = sys.argv[7]
+
 #print("stats={}, gen={}".format(stats, stat_gen))
 
 # Calculate number of routers and endpoints
@@ -99,18 +104,21 @@ for i in range(num_routers):
     port_x_neg.addLink(getLink("x%dy%d"%(their_x,my_y), "x%dy%d"%(my_x,my_y)), "port0", "1ns")
 
 
-    # Y-dim
+    # Y-dim.  The links leaving the upper half of the rows in the
+    # positive direction use slow_latency
     # Positive
     their_y = my_y + 1
     if their_y == y_size:
         their_y = 0
-    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port0", "1ns")
+    latency = slow_latency if my_y >= y_size // 2 else "1ns"
+    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port0", latency)
 
     # Negative
     their_y = my_y - 1
     if their_y == -1:
         their_y = y_size - 1
-    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port0", "1ns")
+    latency = slow_latency if their_y >= y_size // 2 else "1ns"
+    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port0", latency)
 
 
 sst.setStatisticOutput("sst.statOutputCSV")
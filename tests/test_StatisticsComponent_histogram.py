@@ -0,0 +1,80 @@
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+
+########################################################################
+# This script tests the binning of sst.HistogramStatistic
+
+# StatHistInt Component tests the following:
+# - Unsigned and signed integer data
+# - A min value that isn't a multiple of the bin width
+# - A histogram with too many bins to store them all, which only
+#   stores the bins that have been used
+
+# StatHistFloat Component tests the following:
+# - Floating point data
+# - Values that fall outside of the bins
+########################################################################
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+})
+
+StatHistInt = sst.Component("StatHistInt", "coreTestElement.StatisticsComponent.int")
+StatHistInt.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1451",
+      "seed_z" : "1063"
+})
+
+StatHistInt.enableStatistics(["stat1_U32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : 0,
+    "binwidth" : 50,
+    "numbins" : 10})
+
+StatHistInt.enableStatistics(["stat2_U64"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : 0,
+    "binwidth" : 1,
+    "numbins" : 2097152,
+    "dumpbinsonoutput" : False})
+
+StatHistInt.enableStatistics(["stat3_I32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : -205,
+    "binwidth" : 30,
+    "numbins" : 14})
+
+StatHistFloat = sst.Component("StatHistFloat", "coreTestElement.StatisticsComponent.float")
+StatHistFloat.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1453",
+      "seed_z" : "1069"
+})
+
+StatHistFloat.enableStatistics(["stat1_F32"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : 0,
+    "binwidth" : 100,
+    "numbins" : 10})
+
+StatHistFloat.enableStatistics(["stat2_F64"], {
+    "type" : "sst.HistogramStatistic",
+    "minvalue" : 50,
+    "binwidth" : 100,
+    "numbins" : 9})
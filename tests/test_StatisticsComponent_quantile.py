@@ -0,0 +1,64 @@
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+
+########################################################################
+# This script tests sst.QuantileStatistic
+
+# StatQuantInt Component tests the following:
+# - Unsigned and signed integer data with the default quantiles
+# - Custom quantiles and precision
+# - Periodic output with resetOnOutput
+
+# StatQuantFloat Component tests the following:
+# - Floating point data
+########################################################################
+
+sst.setStatisticLoadLevel(4)
+
+sst.setStatisticOutput("sst.statOutputConsole", {
+    "outputsimtime" : True,
+    "outputrank" : False
+})
+
+StatQuantInt = sst.Component("StatQuantInt", "coreTestElement.StatisticsComponent.int")
+StatQuantInt.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1459",
+      "seed_z" : "1087"
+})
+
+StatQuantInt.enableStatistics(["stat1_U32"], {
+    "type" : "sst.QuantileStatistic"})
+
+StatQuantInt.enableStatistics(["stat2_U64"], {
+    "type" : "sst.QuantileStatistic",
+    "precision" : 3,
+    "quantiles" : [0, 25, 50, 75, 100]})
+
+StatQuantInt.enableStatistics(["stat3_I32"], {
+    "type" : "sst.QuantileStatistic",
+    "rate" : "37 ns",
+    "resetOnOutput" : True})
+
+StatQuantFloat = sst.Component("StatQuantFloat", "coreTestElement.StatisticsComponent.float")
+StatQuantFloat.addParams({
+      "rng" : "marsaglia",
+      "count" : "101",
+      "seed_w" : "1471",
+      "seed_z" : "1091"
+})
+
+StatQuantFloat.enableStatistics(["stat2_F64"], {
+    "type" : "sst.QuantileStatistic",
+    "quantiles" : [1, 10, 50, 95, 99.9]})
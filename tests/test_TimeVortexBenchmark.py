@@ -0,0 +1,28 @@
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+import sys
+
+# Sizes and operation counts are kept small so this runs quickly as a
+# test.  Pass sizes as model options to use it as a benchmark, e.g.:
+#   sst test_TimeVortexBenchmark.py --model-options="1000 10000 100000 1000000 10000000"
+sizes = [ 1000, 10000 ]
+if len(sys.argv) > 1:
+    sizes = [ int(x) for x in sys.argv[1:] ]
+
+comp = sst.Component("bench", "coreTestElement.timeVortexBenchmark")
+comp.addParams({
+    "timevortex" : [ "sst.timevortex.priority_queue", "sst.timevortex.map.binned",
+                     "sst.timevortex.ladder_queue", "sst.timevortex.dary_heap" ],
+    "sizes" : sizes,
+    "operations" : 100000,
+    "max_increment" : 1000
+})
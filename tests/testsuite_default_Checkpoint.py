@@ -18,6 +18,7 @@ from sst_unittest import *
 from sst_unittest_support import *
 
 have_mpi = sst_core_config_include_file_get_value(define="SST_CONFIG_HAVE_MPI", type=int, default=0, disable_warning=True) == 1
+have_libz = sst_core_config_include_file_get_value(define="HAVE_LIBZ", type=int, default=0, disable_warning=True) == 1
 
 class testcase_Checkpoint(SSTTestCase):
 
@@ -136,6 +137,9 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_Clocks_basic_start_serial(self) -> None:
         self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", start_serial=True, cpt_suffix="_start_serial")
 
+    def test_Checkpoint_Clocks_basic_binned_map(self) -> None:
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", cpt_suffix="_binned_map", other_args="--timeVortex=sst.timevortex.map.binned")
+
     def test_Checkpoint_Clocks_basic_restart_smaller(self) -> None:
         self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", restart_smaller=True, cpt_suffix="_restart_smaller")
 
@@ -147,6 +151,31 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_Clocks_basic_swap_restart_smaller(self) -> None:
         self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", swap_rank_thread=True, restart_smaller=True, cpt_suffix="_swap_restart_smaller")
 
+    def test_Checkpoint_Clocks_basic_rank_sync_overlap(self) -> None:
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", cpt_suffix="_rank_sync_overlap", other_args="--rank-sync-overlap")
+
+    def test_Checkpoint_Clocks_basic_async(self) -> None:
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", cpt_suffix="_async", other_args="--checkpoint-async")
+
+    # Restart from the second checkpoint, which gets one of the
+    # components from the first checkpoint
+    def test_Checkpoint_Clocks_basic_incremental(self) -> None:
+        self.checkpoint_test_template("Clocks", 2, 2, out_suffix="_basic", cpt_suffix="_incremental", other_args="--checkpoint-incremental")
+
+    def test_Checkpoint_Clocks_basic_incremental_n2one(self) -> None:
+        self.checkpoint_test_template("Clocks", 2, 2, out_suffix="_basic", n_to_one=True, cpt_suffix="_incremental_n2one", other_args="--checkpoint-incremental")
+
+    def test_Checkpoint_Clocks_basic_incremental_restart_smaller(self) -> None:
+        self.checkpoint_test_template("Clocks", 2, 2, out_suffix="_basic", restart_smaller=True, cpt_suffix="_incremental_restart_smaller", other_args="--checkpoint-incremental")
+
+    @unittest.skipIf(not have_libz, "libz is not included as part of this build")
+    def test_Checkpoint_Clocks_basic_compress(self) -> None:
+        self.checkpoint_test_template("Clocks", 1, 2, out_suffix="_basic", cpt_suffix="_compress", other_args="--checkpoint-compress")
+
+    @unittest.skipIf(not have_libz, "libz is not included as part of this build")
+    def test_Checkpoint_Clocks_basic_compress_incremental_n2one(self) -> None:
+        self.checkpoint_test_template("Clocks", 2, 2, out_suffix="_basic", n_to_one=True, cpt_suffix="_compress_incremental_n2one", other_args="--checkpoint-compress --checkpoint-incremental")
+
 
     ### sc_2u2u tests, including repartitioned restart tests
     def test_Checkpoint_sc_2u2u(self) -> None:
@@ -192,6 +221,19 @@ class testcase_Checkpoint(SSTTestCase):
     def test_Checkpoint_MessageMesh_swap_restart_smaller(self) -> None:
         self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", swap_rank_thread=True, restart_smaller=True, cpt_suffix="_swap_restart_smaller")
 
+    def test_Checkpoint_MessageMesh_rank_sync_overlap(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", cpt_suffix="_rank_sync_overlap", other_args="--rank-sync-overlap")
+
+    def test_Checkpoint_MessageMesh_rank_sync_pairwise(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", cpt_suffix="_rank_sync_pairwise", other_args="--rank-sync-pairwise")
+
+    def test_Checkpoint_MessageMesh_async(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", cpt_suffix="_async", other_args="--checkpoint-async")
+
+    @unittest.skipIf(not have_libz, "libz is not included as part of this build")
+    def test_Checkpoint_MessageMesh_compress_async(self) -> None:
+        self.checkpoint_test_template("MessageMesh", 1, 2, modelparams="6 6", cpt_suffix="_compress_async", other_args="--checkpoint-compress --checkpoint-async")
+
 #####
     # This function will run sst 3 times.  In the absence of other options being set, all three runs will use the
     # parallelism set on the command line to the main test script.  The the runs are described here, along with
@@ -246,7 +288,8 @@ class testcase_Checkpoint(SSTTestCase):
     # cr_index: checkpoint index to restart from when restarting from a checkpointed restart run
     # subcom: Set to True if this is a subcomponent test as the file/path name differs
     # modelparams: Set what is passed into --model-params when running SST
-    def checkpoint_test_template(self, testtype: str, rst_index: int = 1, cr_index: int = 0, subcomp: bool = False, modelparams: str = "", out_suffix: str = "", cpt_suffix : str = "", n_to_one: bool = False, swap_rank_thread : bool = False, start_serial : bool = False, restart_smaller : bool = False) -> None:
+    # other_args: Additional command line options for the first checkpoint run
+    def checkpoint_test_template(self, testtype: str, rst_index: int = 1, cr_index: int = 0, subcomp: bool = False, modelparams: str = "", out_suffix: str = "", cpt_suffix : str = "", n_to_one: bool = False, swap_rank_thread : bool = False, start_serial : bool = False, restart_smaller : bool = False, other_args: str = "") -> None:
 
         # name conventions:
         # X_cpt - files/options associated with first checkpoint run
@@ -293,7 +336,7 @@ class testcase_Checkpoint(SSTTestCase):
         options_checkpoint_cpt = (
             "--checkpoint-sim-period='{0}' --checkpoint-prefix={1} "
             "--checkpoint-name-format='%p_%n' --output-directory=testsuite_checkpoint "
-            "--model-options='{2}'".format(checkpoint_period, prefix_cpt, modelparams))
+            "--model-options='{2}' {3}".format(checkpoint_period, prefix_cpt, modelparams, other_args))
 
         if start_serial:
             # Need to run with 1 rank and 1 thread
@@ -0,0 +1,94 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+have_mpi = sst_core_config_include_file_get_value(define="SST_CONFIG_HAVE_MPI", type=int, default=0, disable_warning=True) == 1
+
+class testcase_RankSync(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_RankSync_overlap_Clocks(self):
+        self.ranksync_reffile_test_template("overlap", "Clocks", "--rank-sync-overlap", "_basic")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_RankSync_overlap_MessageMesh(self):
+        self.ranksync_compare_test_template("overlap", "MessageMesh", "--rank-sync-overlap", "6 6")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_RankSync_pairwise_Clocks(self):
+        self.ranksync_reffile_test_template("pairwise", "Clocks", "--rank-sync-pairwise", "_basic")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_RankSync_pairwise_MessageMesh(self):
+        self.ranksync_compare_test_template("pairwise", "MessageMesh", "--rank-sync-pairwise", "6 6")
+
+    # With 4 ranks, each rank gets two rows of the mesh.  Ranks 0, 1
+    # and 2 share 1ns links, while rank 3 only shares 20ns links.
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_RankSync_pairwise_mixed_latency_MessageMesh(self):
+        self.ranksync_compare_test_template("pairwise_mixed_latency", "MessageMesh", "--rank-sync-pairwise", "4 8 1 1 0 0 20ns", num_ranks=4)
+
+#####
+
+    # Runs a test on two ranks with the specified options and compares
+    # against the reference file for the test
+    def ranksync_reffile_test_template(self, name, testtype, sync_options, out_suffix = ""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_{1}{2}.out".format(testsuitedir, testtype, out_suffix)
+        outfile = "{0}/test_RankSync_{1}_{2}{3}.out".format(outdir, name, testtype, out_suffix)
+
+        self.run_sst(sdlfile, outfile, other_args=sync_options, num_ranks=2, num_threads=1)
+
+        filters = [ StartsWithFilter("#"), StartsWithFilter("WARNING: No components are") ]
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, filters)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    # Runs a test serially to generate a reference, then runs it again
+    # on num_ranks ranks with the specified options
+    def ranksync_compare_test_template(self, name, testtype, sync_options, model_options = "", num_ranks = 2):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"{0}\"".format(model_options)
+        check_options = "{0} {1}".format(options, sync_options)
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        outfile_ref = "{0}/test_RankSync_ref_{1}_{2}.out".format(outdir, name, testtype)
+        outfile_check = "{0}/test_RankSync_check_{1}_{2}.out".format(outdir, name, testtype)
+
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=check_options, num_ranks=num_ranks, num_threads=1)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
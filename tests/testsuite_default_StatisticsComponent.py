@@ -42,6 +42,12 @@ class testcase_StatisticComponent(SSTTestCase):
     def test_StatisticsBasic(self):
         self.Statistics_test_template("basic")
 
+    def test_StatisticsHistogram(self):
+        self.Statistics_console_test_template("histogram")
+
+    def test_StatisticsQuantile(self):
+        self.Statistics_console_test_template("quantile")
+
 #####
 
     def Statistics_test_template(self, testtype):
@@ -99,3 +105,19 @@ class testcase_StatisticComponent(SSTTestCase):
             except subprocess.CalledProcessError as h5exc:
                 self.assertTrue(False, "Output/Compare file {0} does not match Reference File {1}. H5diff returned {2} {3}".format(ref_group_stat_file_h5, out_group_stat_file_h5,h5exc.returncode, h5exc.output))
 
+    def Statistics_console_test_template(self, testtype):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StatisticsComponent_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_StatisticsComponent_{1}.out".format(testsuitedir, testtype)
+        outfile = "{0}/test_StatisticsComponent_{1}.out".format(outdir, testtype)
+
+        self.run_sst(sdlfile, outfile)
+
+        filters = [ StartsWithFilter("WARNING: No components are") ]
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, filters)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
@@ -0,0 +1,81 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+class testcase_ThreadSync(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_ThreadSync_dissemination_barrier_Clocks(self):
+        self.threadsync_reffile_test_template("dissemination_barrier", "Clocks", "--dissemination-barrier", "_basic")
+
+    # Use a thread count that isn't a power of two so the last round
+    # of the barrier wraps around
+    def test_ThreadSync_dissemination_barrier_MessageMesh(self):
+        self.threadsync_compare_test_template("dissemination_barrier", "MessageMesh", "--dissemination-barrier", "6 6", num_threads=3)
+
+    def test_ThreadSync_dissemination_barrier_4threads_MessageMesh(self):
+        self.threadsync_compare_test_template("dissemination_barrier_4threads", "MessageMesh", "--dissemination-barrier", "6 6", num_threads=4)
+
+#####
+
+    # Runs a test on two threads with the specified options and
+    # compares against the reference file for the test
+    def threadsync_reffile_test_template(self, name, testtype, sync_options, out_suffix = ""):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_{1}{2}.out".format(testsuitedir, testtype, out_suffix)
+        outfile = "{0}/test_ThreadSync_{1}_{2}{3}.out".format(outdir, name, testtype, out_suffix)
+
+        self.run_sst(sdlfile, outfile, other_args=sync_options, num_ranks=1, num_threads=2)
+
+        filters = [ StartsWithFilter("#"), StartsWithFilter("WARNING: No components are") ]
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, filters)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    # Runs a test serially to generate a reference, then runs it again
+    # on num_threads threads with the specified options
+    def threadsync_compare_test_template(self, name, testtype, sync_options, model_options = "", num_threads = 2):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"{0}\"".format(model_options)
+        check_options = "{0} {1}".format(options, sync_options)
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        outfile_ref = "{0}/test_ThreadSync_ref_{1}_{2}.out".format(outdir, name, testtype)
+        outfile_check = "{0}/test_ThreadSync_check_{1}_{2}.out".format(outdir, name, testtype)
+
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=check_options, num_ranks=1, num_threads=num_threads)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
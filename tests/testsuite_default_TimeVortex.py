@@ -0,0 +1,130 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    def test_TimeVortex_ladder_queue_Clocks(self):
+        self.timevortex_reffile_test_template("ladder_queue", "Clocks", "_basic")
+
+    def test_TimeVortex_ladder_queue_MessageMesh(self):
+        self.timevortex_compare_test_template("ladder_queue", "MessageMesh", "6 6")
+
+    def test_TimeVortex_dary_heap_Clocks(self):
+        self.timevortex_reffile_test_template("dary_heap", "Clocks", "_basic")
+
+    def test_TimeVortex_dary_heap_MessageMesh(self):
+        self.timevortex_compare_test_template("dary_heap", "MessageMesh", "6 6")
+
+    def test_TimeVortex_binned_map_Clocks(self):
+        self.timevortex_reffile_test_template("map.binned", "Clocks", "_basic")
+
+    def test_TimeVortex_binned_map_MessageMesh(self):
+        self.timevortex_compare_test_template("map.binned", "MessageMesh", "6 6")
+
+    def test_TimeVortex_priority_queue_batch_dispatch_Clocks(self):
+        self.timevortex_reffile_test_template("priority_queue", "Clocks", "_basic", batch_dispatch=True)
+
+    def test_TimeVortex_priority_queue_batch_dispatch_MessageMesh(self):
+        self.timevortex_compare_test_template("priority_queue", "MessageMesh", "6 6", batch_dispatch=True)
+
+    def test_TimeVortex_dary_heap_batch_dispatch_MessageMesh(self):
+        self.timevortex_compare_test_template("dary_heap", "MessageMesh", "6 6", batch_dispatch=True)
+
+    def test_TimeVortex_Benchmark(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_TimeVortexBenchmark.py".format(testsuitedir)
+        reffile = "{0}/refFiles/test_TimeVortexBenchmark.out".format(testsuitedir)
+        outfile = "{0}/test_TimeVortexBenchmark.out".format(outdir)
+
+        # The benchmark does all of its work in setup() on a single
+        # component, so there is nothing to gain from running in parallel
+        self.run_sst(sdlfile, outfile, num_ranks=1, num_threads=1)
+
+        # Timing lines start with # and will differ from run to run
+        filters = [ StartsWithFilter("#") ]
+        cmp_result = testing_compare_filtered_diff("TimeVortexBenchmark", outfile, reffile, True, filters)
+        if not cmp_result:
+            diffdata = testing_get_diff_data("TimeVortexBenchmark")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+#####
+
+    # Runs an existing test with the specified TimeVortex and compares
+    # against that test's reference file.  Set batch_dispatch to also
+    # run with --batch-dispatch.
+    def timevortex_reffile_test_template(self, timevortex, testtype, out_suffix = "", batch_dispatch = False):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--timeVortex=sst.timevortex.{0}".format(timevortex)
+        name = timevortex
+        if batch_dispatch:
+            options += " --batch-dispatch"
+            name += "_batch"
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        reffile = "{0}/refFiles/test_{1}{2}.out".format(testsuitedir, testtype, out_suffix)
+        outfile = "{0}/test_TimeVortex_{1}_{2}{3}.out".format(outdir, name, testtype, out_suffix)
+
+        self.run_sst(sdlfile, outfile, other_args=options)
+
+        filters = [ StartsWithFilter("#"), StartsWithFilter("WARNING: No components are") ]
+        cmp_result = testing_compare_filtered_diff(testtype, outfile, reffile, True, filters)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    # Runs a test serially with the default TimeVortex to generate a
+    # reference, then runs it again with the specified TimeVortex.
+    # Set batch_dispatch to run the second time with --batch-dispatch.
+    def timevortex_compare_test_template(self, timevortex, testtype, model_options = "", batch_dispatch = False):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        options = "--model-options=\"{0}\"".format(model_options)
+        check_options = "{0} --timeVortex=sst.timevortex.{1}".format(options, timevortex)
+        name = timevortex
+        if batch_dispatch:
+            check_options += " --batch-dispatch"
+            name += "_batch"
+
+        sdlfile = "{0}/test_{1}.py".format(testsuitedir, testtype)
+        outfile_ref = "{0}/test_TimeVortex_ref_{1}_{2}.out".format(outdir, name, testtype)
+        outfile_check = "{0}/test_TimeVortex_check_{1}_{2}.out".format(outdir, name, testtype)
+
+        self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=check_options)
+
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testtype)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
@@ -40,13 +40,37 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        self.partitioner_test_template("multilevel", "6 6", "sst.multilevel")
+
+    def test_lookahead(self):
+        self.partitioner_test_template("lookahead", "6 6", "sst.lookahead")
+
+    def test_profile(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Do a serial profiling run to generate the partition profile
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_profile_run.out".format(outdir)
+        profile = "{0}/test_partitioner_profile.txt".format(outdir)
+        options = "--model-options=\"6 6\" --enable-profiling=\"events:sst.profile.handler.event.partition(file={0})[event]\"".format(profile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=1)
+
+        with open(profile) as fp:
+            lines = fp.read().splitlines()
+        self.assertEqual(len([l for l in lines if l.startswith("component\t")]), 36, "Profile {0} should have 36 components".format(profile))
+        self.assertTrue(any(l.startswith("port\t") for l in lines), "Profile {0} has no port records".format(profile))
+
+        self.partitioner_test_template("profile", "6 6", "sst.profile", "--partitioner-profile={0}".format(profile))
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def partitioner_test_template(self, testtype, model_options, partitioner, extra_options=""):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        options = "--model-options=\"{0}\" --partitioner={1}".format(model_options, partitioner);
+        options = "--model-options=\"{0}\" --partitioner={1} {2}".format(model_options, partitioner, extra_options);
 
         # Set the various file paths
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)